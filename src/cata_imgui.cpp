@@ -583,6 +583,8 @@ void cataimgui::client::end_frame()
     // A watcher write can land after the outer-boundary drain passed but before
     // this paint. The draw list is finalized; skip only the backend paint.
     if( !renderer_should_abort_frame() ) {
+        // The backend draws through SDL directly, so submit queued sprites under it first.
+        flush_pending_draws();
         ImGui_ImplSDLRenderer3_RenderDrawData( ImGui::GetDrawData(), sdl_renderer.get() );
     }
     ImGuiIO &io = ImGui::GetIO();
@@ -367,6 +367,8 @@ probe_result draw_probe( SDL_Renderer *renderer, SDL_GPURenderState *state,
                          probe_predicate pred )
 {
     probe_result res;
+    // The probe switches target and shader state directly through SDL.
+    flush_pending_draws();
     SDL_Surface *src_surf = SDL_CreateSurface( 1, 1, SDL_PIXELFORMAT_RGBA32 );
     if( !src_surf ) {
         return res;
@@ -654,6 +656,8 @@ variant_pass::begin_result variant_pass::try_begin( variant_kind v )
     if( target == current ) {
         return target != nullptr ? begin_result::bound : begin_result::use_atlas;
     }
+    // Draws queued under the old state must be submitted before it changes.
+    flush_pending_draws();
     if( !SDL_SetGPURenderState( renderer_, target ) ) {
         DebugLog( D_ERROR, DC_ALL )
                 << "cata_shader::variant_pass: SDL_SetGPURenderState failed: "
@@ -688,6 +692,7 @@ bool variant_pass::flush()
     if( !currently_bound_ && !unbind_required_ ) {
         return true;
     }
+    flush_pending_draws();
     if( !SDL_SetGPURenderState( renderer_, nullptr ) ) {
         DebugLog( D_ERROR, DC_ALL )
                 << "cata_shader::variant_pass: SDL_SetGPURenderState(NULL) failed: "
@@ -0,0 +1,123 @@
+#include "cata_thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace cata
+{
+
+thread_pool::thread_pool( const unsigned thread_count )
+{
+    workers.reserve( thread_count );
+    for( unsigned i = 0; i < thread_count; ++i ) {
+        workers.emplace_back( [this]() {
+            work();
+        } );
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock( jobs_mutex );
+        stopping = true;
+    }
+    jobs_available.notify_all();
+    for( std::thread &worker : workers ) {
+        worker.join();
+    }
+}
+
+void thread_pool::enqueue( std::function<void()> job )
+{
+    {
+        std::lock_guard<std::mutex> lock( jobs_mutex );
+        jobs.emplace_back( std::move( job ) );
+    }
+    jobs_available.notify_one();
+}
+
+void thread_pool::work()
+{
+    while( true ) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock( jobs_mutex );
+            jobs_available.wait( lock, [this]() {
+                return stopping || !jobs.empty();
+            } );
+            // Drain the queue before stopping so nobody is left waiting on a future.
+            if( jobs.empty() ) {
+                return;
+            }
+            job = std::move( jobs.front() );
+            jobs.pop_front();
+        }
+        job();
+    }
+}
+
+namespace
+{
+
+struct parallel_for_state {
+    parallel_for_state( size_t count, const std::function<void( size_t )> &f ) :
+        count( count ), f( f ) {}
+
+    const size_t count;
+    const std::function<void( size_t )> f;
+    std::atomic<size_t> next{ 0 };
+    size_t done = 0;
+    std::mutex done_mutex;
+    std::condition_variable all_done;
+
+    // Takes indices until none are left. A job that starts after the others
+    // have finished finds none and never calls f.
+    void run() {
+        size_t ran = 0;
+        for( size_t i = next++; i < count; i = next++ ) {
+            f( i );
+            ++ran;
+        }
+        if( ran == 0 ) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock( done_mutex );
+        done += ran;
+        if( done == count ) {
+            all_done.notify_all();
+        }
+    }
+};
+
+} // namespace
+
+void thread_pool::parallel_for( const size_t count, const std::function<void( size_t )> &f )
+{
+    if( count == 0 ) {
+        return;
+    }
+    // Jobs may outlive this call, so they share the state instead of borrowing it.
+    const std::shared_ptr<parallel_for_state> state =
+        std::make_shared<parallel_for_state>( count, f );
+    const size_t helpers = std::min( workers.size(), count - 1 );
+    for( size_t i = 0; i < helpers; ++i ) {
+        enqueue( [state]() {
+            state->run();
+        } );
+    }
+    state->run();
+    std::unique_lock<std::mutex> lock( state->done_mutex );
+    state->all_done.wait( lock, [&state]() {
+        return state->done == state->count;
+    } );
+}
+
+thread_pool &background_workers()
+{
+    // hardware_concurrency() may report 0 when it does not know.
+    static thread_pool pool( std::max( 2U, std::thread::hardware_concurrency() ) - 1 );
+    return pool;
+}
+
+} // namespace cata
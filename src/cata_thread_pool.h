@@ -0,0 +1,81 @@
+#pragma once
+#ifndef CATA_SRC_CATA_THREAD_POOL_H
+#define CATA_SRC_CATA_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+namespace cata
+{
+
+/**
+ * A fixed set of worker threads consuming a FIFO queue of jobs.
+ *
+ * Jobs must not touch game state that the main thread may be using at the
+ * same time; they are meant for pure computations whose result is handed
+ * back to the main thread through the returned future.
+ */
+class thread_pool
+{
+    public:
+        explicit thread_pool( unsigned thread_count );
+        ~thread_pool();
+
+        thread_pool( const thread_pool & ) = delete;
+        thread_pool &operator=( const thread_pool & ) = delete;
+
+        /** Queue @p f to be run on one of the workers. */
+        template<typename F>
+        std::future<std::invoke_result_t<F>> submit( F &&f ) {
+            using result_t = std::invoke_result_t<F>;
+            // std::function needs a copyable callable, packaged_task is move-only.
+            auto task = std::make_shared<std::packaged_task<result_t()>>( std::forward<F>( f ) );
+            std::future<result_t> result = task->get_future();
+            enqueue( [task]() {
+                ( *task )();
+            } );
+            return result;
+        }
+
+        size_t size() const {
+            return workers.size();
+        }
+
+        /**
+         * Call @p f once for each index in [0, count), spread over the workers and
+         * the calling thread, and return once every call has finished. The calling
+         * thread keeps taking indices itself, so it is never held up by jobs queued
+         * earlier. Calls may run in any order; @p f must not throw.
+         */
+        void parallel_for( size_t count, const std::function<void( size_t )> &f );
+
+    private:
+        void enqueue( std::function<void()> job );
+        void work();
+
+        std::vector<std::thread> workers;
+        std::deque<std::function<void()>> jobs;
+        std::mutex jobs_mutex;
+        std::condition_variable jobs_available;
+        bool stopping = false;
+};
+
+/** Shared pool for background work, sized to leave one core for the main thread. */
+thread_pool &background_workers();
+
+} // namespace cata
+
+#endif // CATA_SRC_CATA_THREAD_POOL_H
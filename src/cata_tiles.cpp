@@ -43,6 +43,7 @@
 #include "flexbuffer_json.h"
 #include "game.h"
 #include "sdl_gamepad.h"
+#include "init.h"
 #include "item.h"
 #include "item_factory.h"
 #include "itype.h"
@@ -98,6 +99,8 @@ static const itype_id itype_corpse( "corpse" );
 
 static const trait_id trait_INATTENTIVE( "INATTENTIVE" );
 
+static const ter_str_id ter_t_open_air( "t_open_air" );
+
 static const trap_str_id tr_unfinished_construction( "tr_unfinished_construction" );
 
 static const std::string ITEM_HIGHLIGHT( "highlight_item" );
@@ -431,6 +434,8 @@ bool service_mode2_upload_interrupt( const atlas_upload_interrupt interrupt,
 void cata_tiles::load_tileset( const std::string &tileset_id, const bool precheck,
                                const bool force, const bool pump_events, const bool terrain )
 {
+    // Queued sprites may refer to the atlas about to be replaced.
+    geometry->flush_sprites();
     renderer_texture_generations gens = renderer_coordinator.texture_generations();
     // Skip the reload only when the same tileset is already bound against the
     // current renderer and texture generations; a generation bump from a
@@ -571,6 +576,18 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
     }
 #endif
 
+    // Charges the time since the previous call to `phase` while profiling.
+    using draw_clock = std::chrono::steady_clock;
+    draw_clock::time_point phase_start = profile_draw ? draw_clock::now()
+                                         : draw_clock::time_point();
+    const auto end_phase = [&]( std::chrono::nanoseconds & phase ) {
+        if( profile_draw ) {
+            const draw_clock::time_point now = draw_clock::now();
+            phase += now - phase_start;
+            phase_start = now;
+        }
+    };
+
     has_animated_tiles_ = false;
 
     {
@@ -1004,6 +1021,19 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
     if( find_tile_looks_like( "shadow", TILE_CATEGORY::NONE, "" ) ) {
         do_draw_shadow = true;
     }
+    end_phase( draw_timings.prepare );
+    const auto layer_phase = [this]( decltype( &cata_tiles::draw_furniture ) f ) {
+        if( f == &cata_tiles::draw_field_or_item ) {
+            return &draw_timings.items;
+        }
+        if( f == &cata_tiles::draw_critter_at ) {
+            return &draw_timings.critters;
+        }
+        if( f == &cata_tiles::draw_zone_mark || f == &cata_tiles::draw_zombie_revival_indicators ) {
+            return &draw_timings.overlays;
+        }
+        return &draw_timings.terrain;
+    };
 
     // Multi z-level draw mode
     // Start drawing from the lowest visible z-level (some off-screen tiles
@@ -1090,6 +1120,7 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
                     p.com.tint_sprites.clear();
                 }
             }
+            end_phase( draw_timings.overlays );
             // --- Layer loop ---
             // Draw all layers (terrain, furniture, items, creatures, etc.).
             // For ortho tinted tiles, we wire up m_cur_bounds and m_cur_tint_sprites
@@ -1138,6 +1169,9 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
                         }
                     }
                 }
+                if( profile_draw ) {
+                    end_phase( *layer_phase( f ) );
+                }
             }
             m_cur_bounds = nullptr;
             m_cur_tint_sprites = nullptr;
@@ -1385,6 +1419,7 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
                     SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_NONE );
                 }
             }
+            end_phase( draw_timings.overlays );
         }
         cur_zlevel += 1;
     }
@@ -1462,6 +1497,7 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
             }
         }
     }
+    end_phase( draw_timings.memorize );
 
     in_animation = do_draw_explosion || do_draw_custom_explosion ||
                    do_draw_bullet || do_draw_hit || do_draw_line ||
@@ -1551,6 +1587,10 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
                 "cata_tiles::draw: variant_pass flush failed at end of frame; renderer in undefined state" );
         }
     }
+    end_phase( draw_timings.overlays );
+    if( profile_draw ) {
+        draw_timings.frames++;
+    }
 }
 
 void cata_tiles::set_draw_cache_dirty()
@@ -1915,6 +1955,64 @@ bool cata_tiles::draw_from_id_string( const std::string &id, TILE_CATEGORY categ
             ll, -1, apply_night_vision_goggles, height_3d, intensity_level,
             variant, offset );
 }
+bool cata_tiles::draw_from_id_string( const ter_id &id, const tripoint_bub_ms &pos, int subtile,
+                                      int rota, lit_level ll, bool apply_night_vision_goggles,
+                                      int &height_3d )
+{
+    const std::string &str_id = id.id().str();
+    return cata_tiles::draw_from_id_string_internal( str_id, TILE_CATEGORY::TERRAIN,
+            empty_string, pos, subtile, rota, ll, -1, apply_night_vision_goggles, height_3d, 0, "",
+            point(), &find_tile_looks_like_resolved( resolved_ter, id.to_i(), str_id,
+                    TILE_CATEGORY::TERRAIN, empty_string ) );
+}
+
+bool cata_tiles::draw_from_id_string( const furn_id &id, const tripoint_bub_ms &pos, int subtile,
+                                      int rota, lit_level ll, bool apply_night_vision_goggles,
+                                      int &height_3d )
+{
+    const std::string &str_id = id.id().str();
+    return cata_tiles::draw_from_id_string_internal( str_id, TILE_CATEGORY::FURNITURE,
+            empty_string, pos, subtile, rota, ll, -1, apply_night_vision_goggles, height_3d, 0, "",
+            point(), &find_tile_looks_like_resolved( resolved_furn, id.to_i(), str_id,
+                    TILE_CATEGORY::FURNITURE, empty_string ) );
+}
+
+bool cata_tiles::draw_from_id_string( const mtype &type, const tripoint_bub_ms &pos, int subtile,
+                                      int rota, lit_level ll, bool apply_night_vision_goggles,
+                                      int &height_3d )
+{
+    const std::string &str_id = type.id.str();
+    const std::string &subcategory = type.species.empty() ? empty_string :
+                                     type.species.begin()->str();
+    return cata_tiles::draw_from_id_string_internal( str_id, TILE_CATEGORY::MONSTER,
+            subcategory, pos, subtile, rota, ll, -1, apply_night_vision_goggles, height_3d, 0, "",
+            point(), &find_tile_looks_like_resolved( resolved_mon, type.id.id().to_i(), str_id,
+                    TILE_CATEGORY::MONSTER, empty_string ) );
+}
+
+bool cata_tiles::draw_from_id_string( const trap_id &id, const tripoint_bub_ms &pos, int subtile,
+                                      int rota, lit_level ll, bool apply_night_vision_goggles,
+                                      int &height_3d )
+{
+    const std::string &str_id = id.id().str();
+    return cata_tiles::draw_from_id_string_internal( str_id, TILE_CATEGORY::TRAP,
+            empty_string, pos, subtile, rota, ll, -1, apply_night_vision_goggles, height_3d, 0, "",
+            point(), &find_tile_looks_like_resolved( resolved_trap, id.to_i(), str_id,
+                    TILE_CATEGORY::TRAP, empty_string ) );
+}
+
+bool cata_tiles::draw_from_id_string( const field_type_id &id, const tripoint_bub_ms &pos,
+                                      int subtile, int rota, lit_level ll,
+                                      bool apply_night_vision_goggles, int &height_3d,
+                                      int intensity_level )
+{
+    const std::string &str_id = id.id().str();
+    return cata_tiles::draw_from_id_string_internal( str_id, TILE_CATEGORY::FIELD,
+            empty_string, pos, subtile, rota, ll, -1, apply_night_vision_goggles, height_3d,
+            intensity_level, "", point(), &find_tile_looks_like_resolved( resolved_field, id.to_i(),
+                    str_id, TILE_CATEGORY::FIELD, empty_string ) );
+}
+
 bool cata_tiles::draw_from_id_string_internal( const std::string &id, const tripoint_bub_ms &pos,
         int subtile,
         int rota,
@@ -2083,6 +2181,42 @@ cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
     }
 }
 
+void cata_tiles::validate_resolved_tiles()
+{
+    const season_type season = season_of_year( calendar::turn );
+    // Loading or unloading game data can renumber the int ids and change looks_like
+    // chains while the tileset stays bound.
+    const int data_generation = DynamicDataLoader::get_instance().data_generation();
+    if( resolved_tiles_tileset == tileset_ptr && resolved_tiles_season == season &&
+        resolved_tiles_data_generation == data_generation ) {
+        return;
+    }
+    resolved_ter.clear();
+    resolved_furn.clear();
+    resolved_mon.clear();
+    resolved_trap.clear();
+    resolved_field.clear();
+    resolved_tiles_tileset = tileset_ptr;
+    resolved_tiles_season = season;
+    resolved_tiles_data_generation = data_generation;
+}
+
+cata_tiles::resolved_int_tile &cata_tiles::find_tile_looks_like_resolved(
+    std::vector<resolved_int_tile> &table, const int index, const std::string &id,
+    const TILE_CATEGORY category, const std::string &variant )
+{
+    validate_resolved_tiles();
+    if( static_cast<size_t>( index ) >= table.size() ) {
+        table.resize( index + 1 );
+    }
+    resolved_int_tile &entry = table[index];
+    if( !entry.resolved ) {
+        entry.base = find_tile_looks_like( id, category, variant );
+        entry.resolved = true;
+    }
+    return entry;
+}
+
 bool cata_tiles::find_overlay_looks_like( const bool male, const std::string &overlay,
         const std::string &variant, std::string &draw_id )
 {
@@ -2159,7 +2293,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
         int subtile, int rota, lit_level ll, int retract,
         bool apply_night_vision_goggles, int &height_3d,
         int intensity_level, const std::string &variant,
-        const point &offset )
+        const point &offset, resolved_int_tile *resolved )
 {
     bool nv_color_active = apply_night_vision_goggles && get_option<bool>( "NV_GREEN_TOGGLE" );
     // If the ID string does not produce a drawable tile
@@ -2195,7 +2329,14 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
 
         // Adding to the id like this breaks the fragile string handling that vision level uses for looks_like.
         if( prevent_occlusion_transp && retract > 0 && category != TILE_CATEGORY::OVERMAP_VISION_LEVEL ) {
-            res = find_tile_looks_like( id + "_transparent", category, variant );
+            if( !resolved ) {
+                res = find_tile_looks_like( id + "_transparent", category, variant );
+            } else {
+                if( !resolved->transparent ) {
+                    resolved->transparent = find_tile_looks_like( id + "_transparent", category, variant );
+                }
+                res = *resolved->transparent;
+            }
             if( res ) {
                 tt = &res -> tile();
             }
@@ -2205,14 +2346,27 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
     // check if there is an available intensity tile and if there is use that instead of the basic tile
     // this is only relevant for fields
     if( intensity_level > 0 ) {
-        res = find_tile_looks_like( id + "_int" + std::to_string( intensity_level ), category, variant );
+        if( !resolved ) {
+            res = find_tile_looks_like( id + "_int" + std::to_string( intensity_level ), category, variant );
+        } else {
+            if( static_cast<size_t>( intensity_level ) >= resolved->intensity.size() ) {
+                resolved->intensity.resize( intensity_level + 1 );
+            }
+            std::optional<std::optional<tile_lookup_res>> &by_intensity =
+                        resolved->intensity[intensity_level];
+            if( !by_intensity ) {
+                by_intensity = find_tile_looks_like(
+                                   id + "_int" + std::to_string( intensity_level ), category, variant );
+            }
+            res = *by_intensity;
+        }
         if( res ) {
             tt = &res -> tile();
         }
     }
     // if a tile with intensity hasn't already been found then fall back to a base tile
     if( !res ) {
-        res = find_tile_looks_like( id, category, variant );
+        res = resolved ? resolved->base : find_tile_looks_like( id, category, variant );
         if( res ) {
             tt = &res -> tile();
         }
@@ -2781,15 +2935,15 @@ bool cata_tiles::draw_sprite_at(
     if( rotate_sprite ) {
         if( rota == -1 ) {
             // flip horizontally
-            ret = sprite_tex->render_copy_ex(
-                      renderer, &destination, 0, nullptr,
+            ret = sprite_tex->render_batched(
+                      *geometry, renderer, destination, 0,
                       static_cast<CataFlipMode>( SDL_FLIP_HORIZONTAL ) );
         } else {
             switch( rota % 4 ) {
                 default:
                 case 0:
                     // unrotated (and 180, with just two sprites)
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
+                    ret = sprite_tex->render_batched( *geometry, renderer, destination, 0,
                                                       SDL_FLIP_NONE );
                     break;
                 case 1:
@@ -2803,10 +2957,10 @@ bool cata_tiles::draw_sprite_at(
 #endif
                     if( !iso ) {
                         // never rotate isometric tiles
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 90, nullptr,
+                        ret = sprite_tex->render_batched( *geometry, renderer, destination, 90,
                                                           SDL_FLIP_NONE );
                     } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
+                        ret = sprite_tex->render_batched( *geometry, renderer, destination, 0,
                                                           SDL_FLIP_NONE );
                     }
                     break;
@@ -2814,11 +2968,11 @@ bool cata_tiles::draw_sprite_at(
                     // 180 degrees, implemented with flips instead of rotation
                     if( !iso ) {
                         // never flip isometric tiles vertically
-                        ret = sprite_tex->render_copy_ex(
-                                  renderer, &destination, 0, nullptr,
+                        ret = sprite_tex->render_batched(
+                                  *geometry, renderer, destination, 0,
                                   static_cast<CataFlipMode>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL ) );
                     } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
+                        ret = sprite_tex->render_batched( *geometry, renderer, destination, 0,
                                                           SDL_FLIP_NONE );
                     }
                     break;
@@ -2833,10 +2987,10 @@ bool cata_tiles::draw_sprite_at(
 #endif
                     if( !iso ) {
                         // never rotate isometric tiles
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, -90, nullptr,
+                        ret = sprite_tex->render_batched( *geometry, renderer, destination, -90,
                                                           SDL_FLIP_NONE );
                     } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
+                        ret = sprite_tex->render_batched( *geometry, renderer, destination, 0,
                                                           SDL_FLIP_NONE );
                     }
                     break;
@@ -2844,7 +2998,7 @@ bool cata_tiles::draw_sprite_at(
         }
     } else {
         // don't rotate, same as case 0 above
-        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+        ret = sprite_tex->render_batched( *geometry, renderer, destination, 0, SDL_FLIP_NONE );
     }
 
     printErrorIf( ret != 0, "SDL_RenderCopyEx() failed" );
@@ -3002,9 +3156,8 @@ bool cata_tiles::draw_terrain( const tripoint_bub_ms &p, const lit_level ll, int
     }
     // first memorize the actual terrain
     const ter_id &t = here.ter( p );
-    const std::string &tname = t.id().str();
     // Legacy mode does not draw fog sprites
-    if( fov_3d_z_range == 0 && tname == "t_open_air" ) {
+    if( fov_3d_z_range == 0 && t == ter_t_open_air ) {
         return false;
     }
     if( t && !invisible[0] ) {
@@ -3022,14 +3175,14 @@ bool cata_tiles::draw_terrain( const tripoint_bub_ms &p, const lit_level ll, int
             // do something to get other terrain orientation values
         }
         if( here.memory_cache_ter_is_dirty( p ) ) {
-            get_avatar().memorize_terrain( here.get_abs( p ), tname, subtile, rotation );
+            get_avatar().memorize_terrain( here.get_abs( p ), t.id().str(), subtile, rotation );
         }
         // draw the actual terrain if there's no override
         if( !neighborhood_overridden ) {
             return memorize_only
                    ? false
-                   : draw_from_id_string( tname, TILE_CATEGORY::TERRAIN, empty_string, p, subtile,
-                                          rotation, ll, nv_goggles_activated, height_3d );
+                   : draw_from_id_string( t, p, subtile, rotation, ll, nv_goggles_activated,
+                                          height_3d );
         }
     }
     if( invisible[0] ? overridden : neighborhood_overridden ) {
@@ -3050,15 +3203,13 @@ bool cata_tiles::draw_terrain( const tripoint_bub_ms &p, const lit_level ll, int
                 get_terrain_orientation( p, rotation, subtile, terrain_override, invisible,
                                          rotate_group );
             }
-            const std::string &tname = t2.id().str();
             // tile overrides are never memorized
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? lit_level::LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
             return memorize_only
                    ? false
-                   : draw_from_id_string( tname, TILE_CATEGORY::TERRAIN, empty_string, p, subtile,
-                                          rotation, lit, nv, height_3d );
+                   : draw_from_id_string( t2, p, subtile, rotation, lit, nv, height_3d );
         }
     } else if( invisible[0] ) {
         // try drawing memory if invisible and not overridden
@@ -3119,8 +3270,8 @@ bool cata_tiles::draw_furniture( const tripoint_bub_ms &p, const lit_level ll, i
         if( !neighborhood_overridden ) {
             return memorize_only
                    ? false
-                   : draw_from_id_string( fname, TILE_CATEGORY::FURNITURE, empty_string, p, subtile,
-                                          rotation, ll, nv_goggles_activated, height_3d );
+                   : draw_from_id_string( f, p, subtile, rotation, ll, nv_goggles_activated,
+                                          height_3d );
         }
     }
     if( invisible[0] ? overridden : neighborhood_overridden ) {
@@ -3151,15 +3302,13 @@ bool cata_tiles::draw_furniture( const tripoint_bub_ms &p, const lit_level ll, i
                 get_tile_values_with_ter( p, f.to_i(), neighborhood, subtile, rotation, rotate_group );
             }
             get_tile_values_with_ter( p, f2.to_i(), neighborhood, subtile, rotation, 0 );
-            const std::string &fname = f2.id().str();
             // tile overrides are never memorized
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? lit_level::LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
             return memorize_only
                    ? false
-                   : draw_from_id_string( fname, TILE_CATEGORY::FURNITURE, empty_string, p, subtile,
-                                          rotation, lit, nv, height_3d );
+                   : draw_from_id_string( f2, p, subtile, rotation, lit, nv, height_3d );
         }
     } else if( invisible[0] ) {
         // try drawing memory if invisible and not overridden
@@ -3204,16 +3353,15 @@ bool cata_tiles::draw_trap( const tripoint_bub_ms &p, const lit_level ll, int &h
         int subtile = 0;
         int rotation = 0;
         get_tile_values( tr.loadid.to_i(), neighborhood, subtile, rotation, 0 );
-        const std::string trname = tr.loadid.id().str();
         if( here.memory_cache_dec_is_dirty( p ) ) {
-            you.memorize_decoration( here.get_abs( p ), trname, subtile, rotation );
+            you.memorize_decoration( here.get_abs( p ), tr.loadid.id().str(), subtile, rotation );
         }
         // draw the actual trap if there's no override
         if( !neighborhood_overridden ) {
             return memorize_only
                    ? false
-                   : draw_from_id_string( trname, TILE_CATEGORY::TRAP, empty_string, p, subtile,
-                                          rotation, ll, nv_goggles_activated, height_3d );
+                   : draw_from_id_string( tr.loadid, p, subtile, rotation, ll, nv_goggles_activated,
+                                          height_3d );
         }
     }
     if( overridden || ( !invisible[0] && neighborhood_overridden &&
@@ -3237,15 +3385,13 @@ bool cata_tiles::draw_trap( const tripoint_bub_ms &p, const lit_level ll, int &h
             int subtile = 0;
             int rotation = 0;
             get_tile_values( tr2.to_i(), neighborhood, subtile, rotation, 0 );
-            const std::string &trname = tr2.id().str();
             // tile overrides are never memorized
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? lit_level::LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
             return memorize_only
                    ? false
-                   : draw_from_id_string( trname, TILE_CATEGORY::TRAP, empty_string, p, subtile,
-                                          rotation, lit, nv, height_3d );
+                   : draw_from_id_string( tr2, p, subtile, rotation, lit, nv, height_3d );
         }
     } else if( invisible[0] ) {
         // try drawing memory if invisible and not overridden
@@ -3451,8 +3597,8 @@ bool cata_tiles::draw_field_or_item( const tripoint_bub_ms &p, const lit_level l
                                                         neighborhood );
                 }
                 if( !has_drawn_field ) {
-                    draw_from_id_string( fld.id().str(), TILE_CATEGORY::FIELD, empty_string,
-                                         p, subtile, rotation, ll, nv_goggles_activated, height_3d, intensity );
+                    draw_from_id_string( fld, p, subtile, rotation, ll, nv_goggles_activated,
+                                         height_3d, intensity );
                 }
             }
         }
@@ -3481,8 +3627,8 @@ bool cata_tiles::draw_field_or_item( const tripoint_bub_ms &p, const lit_level l
 
             //get field intensity
             int intensity = fld_overridden ? 0 : here.field_at( p ).displayed_intensity();
-            ret_draw_field = draw_from_id_string( fld.id().str(), TILE_CATEGORY::FIELD, empty_string,
-                                                  p, subtile, rotation, lit, false, height_3d, intensity );
+            ret_draw_field = draw_from_id_string( fld, p, subtile, rotation, lit, false, height_3d,
+                                                  intensity );
         }
     }
 
@@ -3771,6 +3917,8 @@ bool cata_tiles::draw_critter_at( const tripoint_bub_ms &p, lit_level ll, int &h
                     }
                 } else if( m->has_flag( mon_flag_COPY_AVATAR_LOOK ) ) {
                     draw_entity_with_overlays( *get_avatar().as_character(), p, ll, height_3d, m->facing );
+                } else if( chosen_id == m->type->id.str() ) {
+                    result = draw_from_id_string( *m->type, p, subtile, rot_facing, ll, false, height_3d );
                 } else {
                     result = draw_from_id_string( chosen_id, ent_category, ent_subcategory, p,
                                                   subtile, rot_facing, ll, false, height_3d );
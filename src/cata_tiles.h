@@ -56,6 +56,7 @@ class memorized_tile;
 class monster;
 class nc_color;
 class pixel_minimap;
+struct mtype;
 struct sprite_screen_bounds;
 struct tint_sprite_record;
 enum class direction : unsigned int;
@@ -181,6 +182,14 @@ class texture
             RenderCopyEx( renderer, sdl_texture_ptr.get(), &srcrect, dstrect, angle, center, flip );
             return 0;
         }
+        /// As @ref render_copy_ex rotating around the center of @p dstrect, but
+        /// through @p geometry, which may batch it with other sprites of the same atlas.
+        int render_batched( GeometryRenderer &geometry, const SDL_Renderer_Ptr &renderer,
+                            const SDL_Rect &dstrect, const double angle,
+                            const CataFlipMode flip ) const {
+            geometry.sprite( renderer, sdl_texture_ptr.get(), srcrect, dstrect, angle, flip );
+            return 0;
+        }
 };
 
 // Reason an atlas upload was interrupted. A separate enum from the recovery
@@ -591,6 +600,32 @@ class cata_tiles
         /** Minimap functionality */
         void draw_minimap( const point &dest, const tripoint_bub_ms &center, int width, int height );
 
+        /** Wall-clock time spent in each phase of draw(), summed over frames while profiling. */
+        struct draw_phase_timings {
+            // Viewport setup and rebuilding the draw points cache.
+            std::chrono::nanoseconds prepare{ 0 };
+            // Terrain, furniture, graffiti, traps, constructions and vehicle parts.
+            std::chrono::nanoseconds terrain{ 0 };
+            // Fields and items.
+            std::chrono::nanoseconds items{ 0 };
+            std::chrono::nanoseconds critters{ 0 };
+            // Zone marks, revival indicators, colored light tint, animations and cursors.
+            std::chrono::nanoseconds overlays{ 0 };
+            // Memorizing the tiles in view.
+            std::chrono::nanoseconds memorize{ 0 };
+            int frames = 0;
+        };
+        /** Start or stop accumulating draw_phase_timings. Off by default. */
+        void set_draw_profiling( bool enabled ) {
+            profile_draw = enabled;
+        }
+        const draw_phase_timings &get_draw_timings() const {
+            return draw_timings;
+        }
+        void reset_draw_timings() {
+            draw_timings = {};
+        }
+
     protected:
         /** How many rows and columns of tiles fit into given dimensions, fully
          ** or partially shown, but disregarding any extra contents outside the
@@ -627,13 +662,32 @@ class cata_tiles
                                       std::string &draw_id );
 
     private:
+        // Which sprite a terrain, furniture, monster, trap or field type resolves to,
+        // indexed by its int id.
+        struct resolved_int_tile {
+            bool resolved = false;
+            std::optional<tile_lookup_res> base;
+            // Only looked up once prevent_occlusion asks for it.
+            std::optional<std::optional<tile_lookup_res>> transparent;
+            // The "_int<N>" sprites of fields, indexed by intensity and looked up on first use.
+            std::vector<std::optional<std::optional<tile_lookup_res>>> intensity;
+        };
+        /**
+         * As find_tile_looks_like, but memoized in @p table at @p index, so neither the
+         * plain, the transparent nor the intensity lookup hashes the id string once resolved.
+         */
+        resolved_int_tile &find_tile_looks_like_resolved( std::vector<resolved_int_tile> &table,
+                int index, const std::string &id, TILE_CATEGORY category, const std::string &variant );
+        void validate_resolved_tiles();
         bool draw_from_id_string_internal( const std::string &id, const tripoint_bub_ms &pos, int subtile,
                                            int rota,
                                            lit_level ll, int retract, bool apply_night_vision_goggles, int &height_3d );
+        // @param resolved if not null, the already resolved lookup result for @p id
         bool draw_from_id_string_internal( const std::string &id, TILE_CATEGORY category,
                                            const std::string &subcategory, const tripoint_bub_ms &pos, int subtile, int rota,
                                            lit_level ll, int retract, bool apply_night_vision_goggles, int &height_3d, int intensity_level,
-                                           const std::string &variant, const point &offset );
+                                           const std::string &variant, const point &offset,
+                                           resolved_int_tile *resolved = nullptr );
     protected:
         bool draw_from_id_string( const std::string &id, const tripoint_bub_ms &pos, int subtile, int rota,
                                   lit_level ll,
@@ -676,6 +730,18 @@ class cata_tiles
                                   const std::string &subcategory, const tripoint_bub_ms &pos, int subtile, int rota,
                                   lit_level ll, bool apply_night_vision_goggles, int &height_3d, int intensity_level,
                                   const std::string &variant, const point &offset );
+        bool draw_from_id_string( const ter_id &id, const tripoint_bub_ms &pos, int subtile, int rota,
+                                  lit_level ll, bool apply_night_vision_goggles, int &height_3d );
+        bool draw_from_id_string( const furn_id &id, const tripoint_bub_ms &pos, int subtile, int rota,
+                                  lit_level ll, bool apply_night_vision_goggles, int &height_3d );
+        bool draw_from_id_string( const mtype &type, const tripoint_bub_ms &pos, int subtile, int rota,
+                                  lit_level ll, bool apply_night_vision_goggles, int &height_3d );
+        bool draw_from_id_string( const trap_id &id, const tripoint_bub_ms &pos, int subtile,
+                                  int rota, lit_level ll, bool apply_night_vision_goggles,
+                                  int &height_3d );
+        bool draw_from_id_string( const field_type_id &id, const tripoint_bub_ms &pos, int subtile,
+                                  int rota, lit_level ll, bool apply_night_vision_goggles,
+                                  int &height_3d, int intensity_level );
         bool draw_sprite_at(
             const tile_type &tile, const weighted_int_list<std::vector<int>> &svlist,
             const point &, unsigned int loc_rand, bool rota_fg, int rota,
@@ -932,6 +998,22 @@ class cata_tiles
         // Consumers reach it via get_shared_variant_pass in sdltiles.h.
         std::shared_ptr<const tileset> tileset_ptr;
 
+        // Memo behind find_tile_looks_like_resolved, indexed by int id and filled on
+        // first use. It only caches which sprite a type resolves to; draw() still visits
+        // every visible tile each frame and works out neighbours, lighting and memory as
+        // before. Every entry points into resolved_tiles_tileset and depends on the
+        // season and on the loaded game data (looks_like chains, int ids), so the whole
+        // memo is dropped when any of them changes. Ids without an int id, like items
+        // and vehicle parts, are looked up from scratch.
+        std::vector<resolved_int_tile> resolved_ter;
+        std::vector<resolved_int_tile> resolved_furn;
+        std::vector<resolved_int_tile> resolved_mon;
+        std::vector<resolved_int_tile> resolved_trap;
+        std::vector<resolved_int_tile> resolved_field;
+        std::shared_ptr<const tileset> resolved_tiles_tileset;
+        season_type resolved_tiles_season = season_type::NUM_SEASONS;
+        int resolved_tiles_data_generation = -1;
+
         // the scaled default sprite width and height. in non-isometric mode,
         // the basic tile width and height equal the default sprite width and
         // height, but in isometric mode, the basic tile height is always
@@ -966,6 +1048,9 @@ class cata_tiles
 
         bool disable_occlusion = false;
 
+        bool profile_draw = false;
+        draw_phase_timings draw_timings;
+
         bool do_draw_explosion = false;
         bool do_draw_custom_explosion = false;
         bool do_draw_bullet = false;
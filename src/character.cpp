@@ -31,6 +31,7 @@
 #include "character_martial_arts.h"
 #include "city.h"
 #include "color.h"
+#include "condition.h"
 #include "coordinates.h"
 #include "creature_tracker.h"
 #include "current_map.h"
@@ -393,60 +394,191 @@ int character_max_int = 20;
 
 queued_eocs::queued_eocs() = default;
 
-queued_eocs::queued_eocs( const queued_eocs &rhs )
+queued_eocs::queued_eocs( const queued_eocs &rhs ) : list( rhs.list ), cursor( rhs.cursor )
 {
-    list = rhs.list;
     for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-        queue.emplace( it );
+        schedule( it );
     }
 }
 
 queued_eocs::queued_eocs( queued_eocs &&rhs ) noexcept
 {
-    queue.swap( rhs.queue );
-    list.swap( rhs.list );
+    *this = std::move( rhs );
 }
 
 queued_eocs &queued_eocs::operator=( const queued_eocs &rhs )
 {
-    list = rhs.list;
-    // Why doesn't std::priority_queue have a clear() function.
-    queue = {};
-    for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-        queue.emplace( it );
+    if( this != &rhs ) {
+        clear();
+        list = rhs.list;
+        cursor = rhs.cursor;
+        for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
+            schedule( it );
+        }
     }
     return *this;
 }
+
 queued_eocs &queued_eocs::operator=( queued_eocs &&rhs ) noexcept
 {
-    queue.swap( rhs.queue );
     list.swap( rhs.list );
+    turns.swap( rhs.turns );
+    blocks.swap( rhs.blocks );
+    later.swap( rhs.later );
+    due.swap( rhs.due );
+    std::swap( cursor, rhs.cursor );
+    std::swap( in_wheel, rhs.in_wheel );
     return *this;
 }
 
 bool queued_eocs::empty() const
 {
-    return queue.empty();
+    return list.empty();
 }
 
-const queued_eoc &queued_eocs::top() const
+void queued_eocs::push( const queued_eoc &eoc )
 {
-    return *queue.top();
+    schedule( list.emplace( list.end(), eoc ) );
 }
 
-void queued_eocs::push( const queued_eoc &eoc )
+void queued_eocs::clear()
+{
+    for( std::vector<storage_iter> &slot : turns ) {
+        slot.clear();
+    }
+    for( std::vector<storage_iter> &slot : blocks ) {
+        slot.clear();
+    }
+    later = {};
+    due = {};
+    in_wheel = 0;
+    list.clear();
+}
+
+bool queued_eocs::has_due( const time_point &now )
+{
+    advance( to_turn<int>( now ) );
+    return !due.empty();
+}
+
+queued_eocs::storage_iter queued_eocs::pop_due()
 {
-    auto it = list.emplace( list.end(), eoc );
-    queue.push( it );
+    storage_iter it = due.top();
+    due.pop();
+    return it;
 }
 
-void queued_eocs::pop()
+void queued_eocs::requeue( storage_iter it )
+{
+    schedule( it );
+}
+
+void queued_eocs::erase( storage_iter it )
 {
-    auto it = queue.top();
-    queue.pop();
     list.erase( it );
 }
 
+static int eoc_wheel_block( int turn )
+{
+    return divide_round_down( turn, queued_eocs::wheel_size );
+}
+
+static int eoc_wheel_slot( int index )
+{
+    return index - eoc_wheel_block( index ) * queued_eocs::wheel_size;
+}
+
+void queued_eocs::schedule( storage_iter it )
+{
+    const int turn = to_turn<int>( it->time );
+    if( turn <= cursor ) {
+        due.push( it );
+        return;
+    }
+    const int ahead = eoc_wheel_block( turn ) - eoc_wheel_block( cursor );
+    if( ahead == 0 ) {
+        turns[eoc_wheel_slot( turn )].push_back( it );
+        in_wheel++;
+    } else if( ahead < wheel_size ) {
+        blocks[eoc_wheel_slot( eoc_wheel_block( turn ) )].push_back( it );
+        in_wheel++;
+    } else {
+        later.push( it );
+    }
+}
+
+void queued_eocs::advance( int now )
+{
+    if( now == cursor ) {
+        return;
+    }
+    if( now < cursor || now - cursor >= wheel_size ) {
+        // Time went back (debug menu, tests), or cheaper to sort everything again than to step
+        // through a long stretch of turns.
+        cursor = now;
+        rebuild();
+        return;
+    }
+    while( cursor < now ) {
+        cursor++;
+        if( eoc_wheel_slot( cursor ) == 0 ) {
+            enter_block();
+        }
+        std::vector<storage_iter> &slot = turns[eoc_wheel_slot( cursor )];
+        for( const storage_iter &it : slot ) {
+            due.push( it );
+        }
+        in_wheel -= slot.size();
+        slot.clear();
+    }
+}
+
+void queued_eocs::enter_block()
+{
+    std::vector<storage_iter> arriving;
+    arriving.swap( blocks[eoc_wheel_slot( eoc_wheel_block( cursor ) )] );
+    in_wheel -= arriving.size();
+    for( const storage_iter &it : arriving ) {
+        schedule( it );
+    }
+    pull_later();
+}
+
+void queued_eocs::pull_later()
+{
+    const int last_block = eoc_wheel_block( cursor ) + wheel_size - 1;
+    while( !later.empty() && eoc_wheel_block( to_turn<int>( later.top()->time ) ) <= last_block ) {
+        storage_iter it = later.top();
+        later.pop();
+        schedule( it );
+    }
+}
+
+void queued_eocs::rebuild()
+{
+    std::vector<storage_iter> scheduled;
+    scheduled.reserve( in_wheel );
+    for( std::vector<storage_iter> &slot : turns ) {
+        scheduled.insert( scheduled.end(), slot.begin(), slot.end() );
+        slot.clear();
+    }
+    for( std::vector<storage_iter> &slot : blocks ) {
+        scheduled.insert( scheduled.end(), slot.begin(), slot.end() );
+        slot.clear();
+    }
+    in_wheel = 0;
+    // Entries that were due may not be anymore if cursor went back.
+    scheduled.reserve( scheduled.size() + due.size() );
+    while( !due.empty() ) {
+        scheduled.push_back( due.top() );
+        due.pop();
+    }
+    for( const storage_iter &it : scheduled ) {
+        schedule( it );
+    }
+    pull_later();
+}
+
 void Character::queue_effects( const std::vector<effect_on_condition_id> &effects )
 {
     for( const effect_on_condition_id &eoc_id : effects ) {
@@ -5857,7 +5989,7 @@ void Character::on_mutation_gain( const trait_id &mid )
     morale->on_mutation_gain( mid );
     magic->on_mutation_gain( mid, *this );
     update_type_of_scent( mid );
-    effect_on_conditions::process_reactivate( *this );
+    effect_on_conditions::process_reactivate( *this, condition_reads::traits );
     if( is_avatar() ) {
         as_avatar()->character_mood_face( true );
     }
@@ -5868,7 +6000,7 @@ void Character::on_mutation_loss( const trait_id &mid )
     morale->on_mutation_loss( mid );
     magic->on_mutation_loss( mid, *this );
     update_type_of_scent( mid, false );
-    effect_on_conditions::process_reactivate( *this );
+    effect_on_conditions::process_reactivate( *this, condition_reads::traits );
     if( is_avatar() ) {
         as_avatar()->character_mood_face( true );
     }
@@ -3,6 +3,7 @@
 #define CATA_SRC_CHARACTER_H
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <climits>
 #include <cstdint>
@@ -321,30 +322,68 @@ struct eoc_compare {
     }
 };
 
-struct queued_eocs {
-    using storage_iter = std::list<queued_eoc>::iterator;
+// Queued effect_on_conditions, kept in a hierarchical timer wheel so that checking for due
+// entries each turn costs time proportional to the entries that are actually due.
+//
+// The first level has a slot for each turn of the current wheel_size turn block, the second a
+// slot for each of the following blocks up to wheel_size blocks ahead. Entries further out wait
+// in a heap and move into the wheel as it reaches their block.
+class queued_eocs
+{
+    public:
+        using storage_iter = std::list<queued_eoc>::iterator;
 
-    struct eoc_compare : ::eoc_compare {
-        bool operator()( const storage_iter &lhs, const storage_iter &rhs ) const {
-            return ::eoc_compare::operator()( *lhs, *rhs );
-        }
-    };
-    std::priority_queue<storage_iter, std::vector<storage_iter>, eoc_compare> queue;
-    std::list<queued_eoc> list;
+        struct eoc_compare : ::eoc_compare {
+            bool operator()( const storage_iter &lhs, const storage_iter &rhs ) const {
+                return ::eoc_compare::operator()( *lhs, *rhs );
+            }
+        };
+        using heap_t = std::priority_queue<storage_iter, std::vector<storage_iter>, eoc_compare>;
+        static constexpr int wheel_size = 64;
 
-    queued_eocs();
+        // All queued entries, in no particular order. Entries returned by pop_due() stay here until
+        // they are erased or requeued.
+        std::list<queued_eoc> list;
 
-    queued_eocs( const queued_eocs &rhs );
-    queued_eocs( queued_eocs &&rhs ) noexcept;
+        queued_eocs();
 
-    queued_eocs &operator=( const queued_eocs &rhs );
-    queued_eocs &operator=( queued_eocs &&rhs ) noexcept;
+        queued_eocs( const queued_eocs &rhs );
+        queued_eocs( queued_eocs &&rhs ) noexcept;
 
-    /* std::priority_queue compatibility layer */
-    bool empty() const;
-    const queued_eoc &top() const;
-    void push( const queued_eoc &eoc );
-    void pop();
+        queued_eocs &operator=( const queued_eocs &rhs );
+        queued_eocs &operator=( queued_eocs &&rhs ) noexcept;
+
+        bool empty() const;
+        void push( const queued_eoc &eoc );
+        void clear();
+
+        // Whether any entry is due at or before now.
+        bool has_due( const time_point &now );
+        // Takes the earliest due entry out of the schedule. Call has_due() first.
+        storage_iter pop_due();
+        // Schedules a popped entry again, at its (updated) time.
+        void requeue( storage_iter it );
+        // Drops a popped entry.
+        void erase( storage_iter it );
+
+    private:
+        std::array<std::vector<storage_iter>, wheel_size> turns;
+        std::array<std::vector<storage_iter>, wheel_size> blocks;
+        heap_t later;
+        heap_t due;
+        // Turn up to which entries have been moved into due.
+        int cursor = 0;
+        // Entries in turns and blocks.
+        size_t in_wheel = 0;
+
+        void schedule( storage_iter it );
+        void advance( int now );
+        // Moves the second level slot of the block cursor just entered into the first level.
+        void enter_block();
+        // Moves entries from later into the wheel once their block is in range.
+        void pull_later();
+        // Sorts the wheel and due again after cursor jumped ahead or back.
+        void rebuild();
 };
 
 struct aim_type {
@@ -142,6 +142,11 @@ diag_value const *computer::maybe_get_value( const std::string &key ) const
     return global_variables::_common_maybe_get_value( key, values );
 }
 
+diag_value const *computer::maybe_get_value( const std::string &key, uint32_t slot ) const
+{
+    return global_variables::_common_maybe_get_value( key, slot, values );
+}
+
 static computer_action computer_action_from_legacy_enum( int val );
 static computer_failure_type computer_failure_type_from_legacy_enum( int val );
 
@@ -172,6 +172,7 @@ class computer
         }
         void remove_value( const std::string &key );
         diag_value const *maybe_get_value( const std::string &key ) const;
+        diag_value const *maybe_get_value( const std::string &key, uint32_t slot ) const;
 
         void remove_option( computer_action action );
 };
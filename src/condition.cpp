@@ -4,6 +4,7 @@
 #include <array>
 #include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -266,6 +267,7 @@ void var_info::_deserialize( JsonObject const &jo )
         jo.allow_omitted_members();
         jo.throw_error( "invalid variable type: expected u/npc/global/var/context_val" );
     }
+    intern();
 
     if( jo.has_member( "default" ) ) {
         // loaded in value_or_var
@@ -362,6 +364,13 @@ static bodypart_id get_bp_from_str( const std::string &ctxt )
 
 void read_condition( const JsonObject &jo, const std::string &member_name,
                      conditional_t::func &condition, bool default_val )
+{
+    condition_reads reads = condition_reads::nothing;
+    read_condition( jo, member_name, condition, default_val, reads );
+}
+
+void read_condition( const JsonObject &jo, const std::string &member_name,
+                     conditional_t::func &condition, bool default_val, condition_reads &reads )
 {
     const auto null_function = [default_val]( const_dialogue const & ) {
         return default_val;
@@ -369,15 +378,18 @@ void read_condition( const JsonObject &jo, const std::string &member_name,
 
     if( !jo.has_member( member_name ) ) {
         condition = null_function;
+        reads = condition_reads::nothing;
     } else if( jo.has_string( member_name ) ) {
         const std::string type = jo.get_string( member_name );
         conditional_t sub_condition( type );
+        reads = sub_condition.reads();
         condition = [sub_condition]( const_dialogue const & d ) {
             return sub_condition( d );
         };
     } else if( jo.has_object( member_name ) ) {
         JsonObject con_obj = jo.get_object( member_name );
         conditional_t sub_condition( con_obj );
+        reads = sub_condition.reads();
         condition = [sub_condition]( const_dialogue const & d ) {
             return sub_condition( d );
         };
@@ -2646,6 +2658,43 @@ parsers_simple = {
     {"is_rotten", &conditional_fun::f_is_rotten },
 };
 
+// What the condition read from jo under key depends on. Trait, bionic and weather conditions
+// only count as reading those when the ids are spelled out; one taking them from a variable
+// also reads the variable.
+static condition_reads reads_of( const JsonObject &jo, std::string_view key )
+{
+    static const std::map<std::string_view, condition_reads> known = {
+        { "u_has_trait", condition_reads::traits },
+        { "npc_has_trait", condition_reads::traits },
+        { "u_has_any_trait", condition_reads::traits },
+        { "npc_has_any_trait", condition_reads::traits },
+        { "u_has_visible_trait", condition_reads::traits },
+        { "npc_has_visible_trait", condition_reads::traits },
+        { "u_is_trait_purifiable", condition_reads::traits },
+        { "npc_is_trait_purifiable", condition_reads::traits },
+        { "u_has_bionics", condition_reads::bionics },
+        { "npc_has_bionics", condition_reads::bionics },
+        { "is_weather", condition_reads::weather },
+    };
+    const auto it = known.find( key );
+    if( it == known.end() ) {
+        return condition_reads::other;
+    }
+    const std::string member( key );
+    if( jo.has_string( member ) ) {
+        return it->second;
+    }
+    if( jo.has_array( member ) ) {
+        for( const JsonValue entry : jo.get_array( member ) ) {
+            if( !entry.test_string() ) {
+                return condition_reads::other;
+            }
+        }
+        return it->second;
+    }
+    return condition_reads::other;
+}
+
 conditional_t::conditional_t( const JsonObject &jo )
 {
     // improve the clarity of NPC setter functions
@@ -2665,34 +2714,18 @@ conditional_t::conditional_t( const JsonObject &jo )
         return conditionals;
     };
     if( jo.has_array( "and" ) ) {
-        std::vector<conditional_t> and_conditionals = parse_array( jo, "and" );
+        *this = joined( parse_array( jo, "and" ), true );
         found_sub_member = true;
-        condition = [acs = std::move( and_conditionals )]( const_dialogue const & d ) {
-            return std::all_of( acs.begin(), acs.end(), [&d]( conditional_t const & cond ) {
-                return cond( d );
-            } );
-        };
     } else if( jo.has_array( "or" ) ) {
-        std::vector<conditional_t> or_conditionals = parse_array( jo, "or" );
+        *this = joined( parse_array( jo, "or" ), false );
         found_sub_member = true;
-        condition = [ocs = std::move( or_conditionals )]( const_dialogue const & d ) {
-            return std::any_of( ocs.begin(), ocs.end(), [&d]( conditional_t const & cond ) {
-                return cond( d );
-            } );
-        };
     } else if( jo.has_object( "not" ) ) {
         JsonObject cond = jo.get_object( "not" );
-        const conditional_t sub_condition = conditional_t( cond );
+        *this = conditional_t( cond ).negated();
         found_sub_member = true;
-        condition = [sub_condition]( const_dialogue const & d ) {
-            return !sub_condition( d );
-        };
     } else if( jo.has_string( "not" ) ) {
-        const conditional_t sub_condition = conditional_t( jo.get_string( "not" ) );
+        *this = conditional_t( jo.get_string( "not" ) ).negated();
         found_sub_member = true;
-        condition = [sub_condition]( const_dialogue const & d ) {
-            return !sub_condition( d );
-        };
     }
     if( !found_sub_member ) {
         for( const std::string &sub_member : dialogue_data::complex_conds() ) {
@@ -2706,14 +2739,14 @@ conditional_t::conditional_t( const JsonObject &jo )
     for( const condition_parser &p : parsers ) {
         if( p.has_beta ) {
             if( p.check( jo ) ) {
-                condition = p.f_beta( jo, p.key_alpha, false );
+                *this = leaf( p.f_beta( jo, p.key_alpha, false ), reads_of( jo, p.key_alpha ) );
                 found = true;
             } else if( p.check( jo, true ) ) {
-                condition = p.f_beta( jo, p.key_beta, true );
+                *this = leaf( p.f_beta( jo, p.key_beta, true ), reads_of( jo, p.key_beta ) );
                 found = true;
             }
         } else if( p.check( jo ) ) {
-            condition = p.f( jo, p.key_alpha );
+            *this = leaf( p.f( jo, p.key_alpha ), reads_of( jo, p.key_alpha ) );
             if( jo.has_member( "math" ) ) {
                 found_sub_member = true;
             }
@@ -2726,10 +2759,7 @@ conditional_t::conditional_t( const JsonObject &jo )
     if( !found ) {
         for( const std::string &sub_member : dialogue_data::simple_string_conds() ) {
             if( jo.has_string( sub_member ) ) {
-                const conditional_t sub_condition( jo.get_string( sub_member ) );
-                condition = [sub_condition]( const_dialogue const & d ) {
-                    return sub_condition( d );
-                };
+                *this = conditional_t( jo.get_string( sub_member ) );
                 found_sub_member = true;
                 break;
             }
@@ -2746,14 +2776,14 @@ conditional_t::conditional_t( std::string_view type )
     for( const condition_parser &p : parsers_simple ) {
         if( p.has_beta ) {
             if( type == p.key_alpha ) {
-                condition = p.f_beta_simple( false );
+                *this = leaf( p.f_beta_simple( false ), condition_reads::other, p.key_alpha );
                 found = true;
             } else if( type == p.key_beta ) {
-                condition = p.f_beta_simple( true );
+                *this = leaf( p.f_beta_simple( true ), condition_reads::other, p.key_beta );
                 found = true;
             }
         } else if( type == p.key_alpha ) {
-            condition = p.f_simple();
+            *this = leaf( p.f_simple(), condition_reads::other, p.key_alpha );
             found = true;
         }
         if( found ) {
@@ -2761,9 +2791,171 @@ conditional_t::conditional_t( std::string_view type )
         }
     }
     if( !found ) {
-        condition = []( const_dialogue const & ) {
-            return false;
-        };
+        *this = constant( false );
+    }
+}
+
+bool conditional_t::operator()( const_dialogue const &d ) const
+{
+    bool result = false;
+    uint64_t known = 0;
+    uint64_t values = 0;
+    size_t pc = 0;
+    while( pc < program.size() ) {
+        const instruction &ins = program[pc++];
+        switch( ins.op ) {
+            case opcode::test:
+                if( ins.slot < 0 ) {
+                    result = leaves[ins.arg]( d );
+                } else {
+                    const uint64_t bit = uint64_t{ 1 } << ins.slot;
+                    if( !( known & bit ) ) {
+                        known |= bit;
+                        if( leaves[ins.arg]( d ) ) {
+                            values |= bit;
+                        }
+                    }
+                    result = values & bit;
+                }
+                break;
+            case opcode::constant:
+                result = ins.value;
+                break;
+            case opcode::negate:
+                result = !result;
+                break;
+            case opcode::jump_unless:
+                if( !result ) {
+                    pc = static_cast<size_t>( ins.arg );
+                }
+                break;
+            case opcode::jump_if:
+                if( result ) {
+                    pc = static_cast<size_t>( ins.arg );
+                }
+                break;
+        }
+    }
+    return result;
+}
+
+conditional_t conditional_t::leaf( func f, condition_reads reads, std::string_view name )
+{
+    conditional_t ret;
+    ret.read_state = reads;
+    instruction ins;
+    ins.op = opcode::test;
+    ret.program.push_back( ins );
+    ret.leaves.push_back( std::move( f ) );
+    ret.leaf_names.push_back( name );
+    return ret;
+}
+
+conditional_t conditional_t::constant( bool value )
+{
+    conditional_t ret;
+    instruction ins;
+    ins.value = value;
+    ret.program.push_back( ins );
+    return ret;
+}
+
+bool conditional_t::is_constant() const
+{
+    return program.size() == 1 && program.front().op == opcode::constant;
+}
+
+conditional_t conditional_t::joined( const std::vector<conditional_t> &conds, bool is_and )
+{
+    // A constant that decides the result replaces the whole list, the others drop out.
+    std::vector<const conditional_t *> kept;
+    for( const conditional_t &cond : conds ) {
+        if( !cond.is_constant() ) {
+            kept.push_back( &cond );
+        } else if( cond.program.front().value != is_and ) {
+            return constant( !is_and );
+        }
+    }
+    if( kept.empty() ) {
+        return constant( is_and );
+    }
+
+    conditional_t ret;
+    std::vector<size_t> exits;
+    for( const conditional_t *cond : kept ) {
+        if( !ret.program.empty() ) {
+            exits.push_back( ret.program.size() );
+            instruction exit;
+            exit.op = is_and ? opcode::jump_unless : opcode::jump_if;
+            ret.program.push_back( exit );
+        }
+        ret.append( *cond );
+    }
+    for( size_t exit : exits ) {
+        ret.program[exit].arg = static_cast<int>( ret.program.size() );
+    }
+    ret.assign_slots();
+    return ret;
+}
+
+conditional_t conditional_t::negated() const
+{
+    if( is_constant() ) {
+        return constant( !program.front().value );
+    }
+    conditional_t ret = *this;
+    instruction ins;
+    ins.op = opcode::negate;
+    ret.program.push_back( ins );
+    return ret;
+}
+
+void conditional_t::append( const conditional_t &sub )
+{
+    read_state |= sub.read_state;
+    std::vector<int> leaf_index;
+    for( size_t i = 0; i < sub.leaves.size(); i++ ) {
+        const std::string_view name = sub.leaf_names[i];
+        auto known = name.empty() ? leaf_names.end() :
+                     std::find( leaf_names.begin(), leaf_names.end(), name );
+        if( known != leaf_names.end() ) {
+            leaf_index.push_back( static_cast<int>( known - leaf_names.begin() ) );
+        } else {
+            leaf_index.push_back( static_cast<int>( leaves.size() ) );
+            leaves.push_back( sub.leaves[i] );
+            leaf_names.push_back( name );
+        }
+    }
+    const int offset = static_cast<int>( program.size() );
+    for( instruction ins : sub.program ) {
+        if( ins.op == opcode::test ) {
+            ins.arg = leaf_index[ins.arg];
+        } else if( ins.op == opcode::jump_unless || ins.op == opcode::jump_if ) {
+            ins.arg += offset;
+        }
+        program.push_back( ins );
+    }
+}
+
+void conditional_t::assign_slots()
+{
+    std::vector<int> tests( leaves.size() );
+    for( const instruction &ins : program ) {
+        if( ins.op == opcode::test ) {
+            tests[ins.arg]++;
+        }
+    }
+    std::vector<int> slot( leaves.size(), -1 );
+    int slots = 0;
+    for( size_t i = 0; i < leaves.size() && slots < max_cached; i++ ) {
+        if( tests[i] > 1 ) {
+            slot[i] = slots++;
+        }
+    }
+    for( instruction &ins : program ) {
+        if( ins.op == opcode::test ) {
+            ins.slot = slot[ins.arg];
+        }
     }
 }
 
@@ -6,6 +6,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_set>
+#include <vector>
 
 #include "calendar.h"
 #include "coords_fwd.h"
@@ -36,6 +37,22 @@ struct enum_traits<jarg> {
     static constexpr bool is_flag_enum = true;
 };
 
+// The state the leaves of a condition read. Changes to traits, bionics and the weather
+// reactivate effect_on_conditions, which only need to recheck the conditions reading them.
+enum class condition_reads : int {
+    nothing = 0,
+    traits = 1,
+    bionics = 1 << 1,
+    weather = 1 << 2,
+    // Anything else, including names only known once the condition is evaluated.
+    other = 1 << 3
+};
+
+template<>
+struct enum_traits<condition_reads> {
+    static constexpr bool is_flag_enum = true;
+};
+
 // DEPRECATED. use mandatory/optional, deserialize, or JsonValue::read
 str_or_var get_str_or_var( const JsonValue &jv, std::string_view member, bool required = true,
                            std::string_view default_val = "" );
@@ -65,13 +82,18 @@ std::string get_talk_var_basename( const JsonObject &jo, std::string_view member
 // the truly awful declaration for the conditional_t loading helper_function
 void read_condition( const JsonObject &jo, const std::string &member_name,
                      std::function<bool( const_dialogue const & )> &condition, bool default_val );
+// As above, also setting what the condition reads.
+void read_condition( const JsonObject &jo, const std::string &member_name,
+                     std::function<bool( const_dialogue const & )> &condition, bool default_val,
+                     condition_reads &reads );
 
 void finalize_conditions();
 
 /**
  * A condition for a response spoken by the player.
  * This struct only adds the constructors which will load the data from json
- * into a lambda, stored in the std::function object.
+ * into a flat predicate program. The conditions from json are its leaves, stored in
+ * std::function objects; "and", "or" and "not" become short-circuit jumps between them.
  * Invoking the function operator with a dialog reference (so the function can access the NPC)
  * returns whether the response is allowed.
  */
@@ -85,15 +107,50 @@ struct conditional_t {
 
         static double get_legacy_dbl( const_dialogue const &d, std::string_view checked_value, char scope );
         static void set_legacy_dbl( dialogue &d, double input, std::string_view checked_value, char scope );
-        bool operator()( const_dialogue const &d ) const {
-            if( !condition ) {
-                return false;
-            }
-            return condition( d );
+        bool operator()( const_dialogue const &d ) const;
+        condition_reads reads() const {
+            return read_state;
         }
 
     private:
-        func condition;
+        enum class opcode : int {
+            // Sets the result to leaves[arg], or to its cached result if slot isn't -1.
+            test = 0,
+            // Sets the result to value.
+            constant,
+            negate,
+            // Jumps to arg if the result is false.
+            jump_unless,
+            // Jumps to arg if the result is true.
+            jump_if,
+        };
+        struct instruction {
+            opcode op = opcode::constant;
+            int arg = 0;
+            int slot = -1;
+            bool value = false;
+        };
+        // Most leaves whose results are cached during one evaluation.
+        static constexpr int max_cached = 64;
+
+        std::vector<instruction> program;
+        std::vector<func> leaves;
+        // The simple string condition each leaf came from, empty for the others. Those are pure,
+        // so one that appears several times in a program is shared and evaluated at most once.
+        std::vector<std::string_view> leaf_names;
+        // What all the leaves read together.
+        condition_reads read_state = condition_reads::nothing;
+
+        static conditional_t leaf( func f, condition_reads reads, std::string_view name = {} );
+        static conditional_t constant( bool value );
+        // All of conds if is_and, any of them otherwise.
+        static conditional_t joined( const std::vector<conditional_t> &conds, bool is_and );
+        conditional_t negated() const;
+        bool is_constant() const;
+        // Appends the program of sub, sharing the named leaves already here.
+        void append( const conditional_t &sub );
+        // Gives the named leaves tested more than once a cache slot.
+        void assign_slots();
 };
 
 #endif // CATA_SRC_CONDITION_H
@@ -2223,6 +2223,11 @@ diag_value const *Creature::maybe_get_value( const std::string &key ) const
     return global_variables::_common_maybe_get_value( key, values );
 }
 
+diag_value const *Creature::maybe_get_value( const std::string &key, uint32_t slot ) const
+{
+    return global_variables::_common_maybe_get_value( key, slot, values );
+}
+
 void Creature::clear_values()
 {
     values.clear();
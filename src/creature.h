@@ -709,6 +709,7 @@ class Creature : public viewer
         void remove_value( const std::string &key );
         diag_value const &get_value( const std::string &key ) const;
         diag_value const *maybe_get_value( const std::string &key ) const;
+        diag_value const *maybe_get_value( const std::string &key, uint32_t slot ) const;
         void clear_values();
 
         virtual units::mass get_weight() const = 0;
@@ -3159,6 +3159,7 @@ static void draw_benchmark( const int max_difference )
 
     static_popup popup;
     popup.on_top( true ).message( "%s", _( "Benchmark in progress…" ) );
+    ui_manager::reset_frame_stats();
 
     while( true ) {
         end_tick = std::chrono::steady_clock::now();
@@ -3188,6 +3189,9 @@ static void draw_benchmark( const int max_difference )
 
     add_msg( m_info, _( "Drew %d times in %.3f seconds.  (%.3f fps average)" ), draw_counter,
              difference / 1000.0, 1000.0 * draw_counter / static_cast<double>( difference ) );
+    const ui_manager::frame_stats &stats = ui_manager::get_frame_stats();
+    add_msg( m_info, _( "Frame time: %.2f ms average, %.2f ms worst." ),
+             stats.average_frame.count() / 1000.0, stats.worst_frame.count() / 1000.0 );
 }
 
 static void debug_menu_game_state()
@@ -268,6 +268,7 @@ struct const_dialogue {
                               const std::function<bool( const_dialogue const & )> &value );
         diag_value const &get_value( const std::string &key ) const;
         diag_value const *maybe_get_value( const std::string &key ) const;
+        diag_value const *maybe_get_value( const std::string &key, uint32_t slot ) const;
 
         bool evaluate_conditional( const std::string &key, const_dialogue const &d ) const;
 
@@ -28,19 +28,19 @@ diag_value const *maybe_read_var_value( const var_info &info, const_dialogue con
     global_variables &globvars = get_globals();
     switch( info.type ) {
         case var_type::global:
-            return globvars.maybe_get_global_value( info.name );
+            return globvars.maybe_get_global_value( info.name, info.slot );
         case var_type::context:
-            return d.maybe_get_value( info.name );
+            return d.maybe_get_value( info.name, info.slot );
         case var_type::u: {
             const_talker const *alpha = d.const_actor( false );
-            return alpha ? alpha->maybe_get_value( info.name ) : nullptr;
+            return alpha ? alpha->maybe_get_slot_value( info.name, info.slot ) : nullptr;
         }
         case var_type::npc: {
             const_talker const *beta = d.const_actor( true );
-            return beta ? beta->maybe_get_value( info.name ) : nullptr;
+            return beta ? beta->maybe_get_slot_value( info.name, info.slot ) : nullptr;
         }
         case var_type::var: {
-            diag_value const *const var_val = d.maybe_get_value( info.name );
+            diag_value const *const var_val = d.maybe_get_value( info.name, info.slot );
             return var_val ? maybe_read_var_value( process_variable( var_val->str() ), d ) : nullptr;
         }
         case var_type::last:
@@ -49,6 +49,11 @@ diag_value const *maybe_read_var_value( const var_info &info, const_dialogue con
     return nullptr;
 }
 
+void var_info::intern()
+{
+    slot = var_slots::intern( name );
+}
+
 var_info process_variable( const std::string &type )
 {
     var_type vt = var_type::global;
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "calendar.h"
+#include "global_vars.h"
 #include "translation.h"
 
 class JsonObject;
@@ -48,6 +49,11 @@ struct var_info {
     var_info() : type( var_type::last ) {}
     var_type type;
     std::string name;
+    // The slot of name if it was interned at load time, var_slots::none otherwise.
+    uint32_t slot = var_slots::none;
+
+    // Gives name a slot. Only for names fixed by the loaded data, not ones built at runtime.
+    void intern();
 
     void _deserialize( JsonObject const &jo );
     void deserialize( JsonValue const &jsin );
@@ -489,10 +489,19 @@ void game::handle_progress_ui()
         }
     }
     if( wait_redraw ) {
+        // Only the drawing is paced to the fast-forward frame rate. A redraw of the
+        // main UI that falls on a skipped frame is still owed, and drawn with the
+        // next frame that is due.
+        if( calendar::once_every( wait_refresh_rate ) ) {
+            wait_main_redraw_owed = true;
+        }
         if( first_redraw_since_waiting_started ||
-            calendar::once_every( std::min( 1_minutes, wait_refresh_rate ) ) ) {
-            if( first_redraw_since_waiting_started || calendar::once_every( wait_refresh_rate ) ) {
+            ( ( wait_main_redraw_owed ||
+                calendar::once_every( std::min( 1_minutes, wait_refresh_rate ) ) ) &&
+              ui_manager::fast_forward_frame_due() ) ) {
+            if( first_redraw_since_waiting_started || wait_main_redraw_owed ) {
                 ui_manager::redraw();
+                wait_main_redraw_owed = false;
             }
 
             // Avoid redrawing the main UI every time due to invalidation
@@ -516,6 +525,7 @@ void game::handle_progress_ui()
         // Nothing to wait for now
         wait_popup_reset();
         first_redraw_since_waiting_started = true;
+        wait_main_redraw_owed = false;
     }
 }
 
@@ -645,10 +655,18 @@ bool game::do_turn()
                 }
                 explosion_handler::process_explosions();
                 sounds::process_sound_markers( &u );
-                if( !u.activity && uquit != QUIT_WATCH
-                    && ( !u.has_distant_destination() || calendar::once_every( 10_seconds ) ) ) {
-                    wait_popup_reset();
-                    ui_manager::redraw();
+                if( !u.activity && uquit != QUIT_WATCH ) {
+                    if( !u.has_distant_destination() ) {
+                        wait_popup_reset();
+                        ui_manager::redraw();
+                    } else if( travel_redraw_owed || calendar::once_every( 10_seconds ) ) {
+                        // Owed until a fast-forward frame is due.
+                        travel_redraw_owed = !ui_manager::fast_forward_frame_due();
+                        if( !travel_redraw_owed ) {
+                            wait_popup_reset();
+                            ui_manager::redraw();
+                        }
+                    }
                 }
 
                 if( queue_screenshot ) {
@@ -751,8 +769,13 @@ bool game::do_turn()
     u.process_turn();
 
     if( u.get_moves() < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
-        ui_manager::redraw();
-        refresh_display();
+        // Activities and sleep pass many turns a second; only draw as many of
+        // them as anyone can see.
+        const bool fast_forward = u.activity || u.has_effect( effect_sleep );
+        if( !fast_forward || ui_manager::fast_forward_frame_due() ) {
+            ui_manager::redraw();
+            refresh_display();
+        }
     }
 
     if( levz >= 0 && !u.is_underwater() ) {
@@ -104,7 +104,7 @@ void effect_on_condition::load( const JsonObject &jo, std::string_view src )
     }
 
     if( jo.has_member( "deactivate_condition" ) ) {
-        read_condition( jo, "deactivate_condition", deactivate_condition, false );
+        read_condition( jo, "deactivate_condition", deactivate_condition, false, deactivate_reads );
         has_deactivate_condition = true;
     }
     if( jo.has_member( "condition" ) ) {
@@ -182,15 +182,14 @@ static void process_new_eocs( queued_eocs &eoc_queue,
                               std::map<effect_on_condition_id, bool> &new_eocs, bool global_queue )
 {
     queued_eocs temp_queued_eocs;
-    while( !eoc_queue.empty() ) {
+    for( const queued_eoc &queued : eoc_queue.list ) {
         // Check if EoC is moved from global to local, or vice versa
-        if( global_queue == eoc_queue.top().eoc->global ) {
-            if( eoc_queue.top().eoc.is_valid() ) {
-                temp_queued_eocs.push( eoc_queue.top() );
+        if( global_queue == queued.eoc->global ) {
+            if( queued.eoc.is_valid() ) {
+                temp_queued_eocs.push( queued );
             }
-            new_eocs[eoc_queue.top().eoc] = false;
+            new_eocs[queued.eoc] = false;
         }
-        eoc_queue.pop();
     }
     eoc_queue = std::move( temp_queued_eocs );
     for( auto eoc = eoc_vector.begin();
@@ -272,11 +271,9 @@ static void process_eocs( queued_eocs &eoc_queue, std::vector<effect_on_conditio
             eocs_to_queue.clear();
         } };
 
-    while( !eoc_queue.empty() &&
-           eoc_queue.top().time <= calendar::turn ) {
-        queued_eocs::storage_iter it = eoc_queue.queue.top();
+    while( eoc_queue.has_due( calendar::turn ) ) {
+        queued_eocs::storage_iter it = eoc_queue.pop_due();
         queued_eoc &top = *it;
-        eoc_queue.queue.pop();
 
         dialogue nested_d{ d };
         for( const auto &val : top.context ) {
@@ -294,15 +291,15 @@ static void process_eocs( queued_eocs &eoc_queue, std::vector<effect_on_conditio
                     eocs_to_queue.emplace_back( it );
                 } else { // It failed and should be deactivated for now
                     eoc_vector.push_back( top.eoc );
-                    eoc_queue.list.erase( it );
+                    eoc_queue.erase( it );
                 }
             }
         } else {
-            eoc_queue.list.erase( it );
+            eoc_queue.erase( it );
         }
     }
     for( queued_eocs::storage_iter &q_eoc : eocs_to_queue ) {
-        eoc_queue.queue.emplace( q_eoc );
+        eoc_queue.requeue( q_eoc );
     }
 }
 
@@ -319,33 +316,48 @@ void effect_on_conditions::process_effect_on_conditions( Character &you )
 
 static void process_reactivation( std::vector<effect_on_condition_id>
                                   &inactive_effect_on_condition_vector,
-                                  queued_eocs &queued_effect_on_conditions, dialogue &d )
+                                  queued_eocs &queued_effect_on_conditions, dialogue &d,
+                                  condition_reads changed )
 {
+    // Checks every condition before queueing any, then drops the reactivated ones in one pass.
+    // Conditions that do not read what changed still hold and are not evaluated.
     std::vector<effect_on_condition_id> ids_to_reactivate;
     for( const effect_on_condition_id &eoc : inactive_effect_on_condition_vector ) {
-        if( !eoc->check_deactivate( d ) ) {
+        if( eoc->reactivated_by( changed ) && !eoc->check_deactivate( d ) ) {
             ids_to_reactivate.push_back( eoc );
         }
     }
+    if( ids_to_reactivate.empty() ) {
+        return;
+    }
     for( const effect_on_condition_id &eoc : ids_to_reactivate ) {
         queued_effect_on_conditions.push( queued_eoc{ eoc, calendar::turn + next_recurrence( eoc, d ), d.get_context() } );
-        inactive_effect_on_condition_vector.erase( std::remove(
-                    inactive_effect_on_condition_vector.begin(), inactive_effect_on_condition_vector.end(),
-                    eoc ), inactive_effect_on_condition_vector.end() );
     }
+    std::sort( ids_to_reactivate.begin(), ids_to_reactivate.end() );
+    inactive_effect_on_condition_vector.erase( std::remove_if(
+                inactive_effect_on_condition_vector.begin(), inactive_effect_on_condition_vector.end(),
+    [&ids_to_reactivate]( const effect_on_condition_id & eoc ) {
+        return std::binary_search( ids_to_reactivate.begin(), ids_to_reactivate.end(), eoc );
+    } ), inactive_effect_on_condition_vector.end() );
 }
 
-void effect_on_conditions::process_reactivate( Character &you )
+void effect_on_conditions::process_reactivate( Character &you, condition_reads changed )
 {
     dialogue d( get_talker_for( you ), nullptr );
-    process_reactivation( you.inactive_effect_on_condition_vector, you.queued_effect_on_conditions, d );
+    // Weather changes never get here, so conditions reading the weather are rechecked on
+    // every trait and bionic change instead.
+    process_reactivation( you.inactive_effect_on_condition_vector, you.queued_effect_on_conditions, d,
+                          changed | condition_reads::weather );
 }
 
-void effect_on_conditions::process_reactivate()
+void effect_on_conditions::process_reactivate( condition_reads changed )
 {
     dialogue d( get_talker_for( get_avatar() ), nullptr );
+    // Trait and bionic changes never get here, so conditions reading them are rechecked on
+    // every weather change instead.
     process_reactivation( g->inactive_global_effect_on_condition_vector,
-                          g->queued_global_effect_on_conditions, d );
+                          g->queued_global_effect_on_conditions, d,
+                          changed | condition_reads::traits | condition_reads::bionics );
 }
 
 bool effect_on_condition::activate( dialogue &d, bool require_callstack_check ) const
@@ -424,6 +436,14 @@ bool effect_on_condition::check_deactivate( const_dialogue const &d ) const
     return deactivate_condition( d );
 }
 
+bool effect_on_condition::reactivated_by( condition_reads changed ) const
+{
+    if( !has_deactivate_condition || has_false_effect ) {
+        return true;
+    }
+    return static_cast<bool>( deactivate_reads & ( changed | condition_reads::other ) );
+}
+
 bool effect_on_condition::test_condition( const_dialogue const &d ) const
 {
     return !has_condition || condition( d );
@@ -436,13 +456,9 @@ void effect_on_condition::apply_true_effects( dialogue &d )  const
 
 void effect_on_conditions::clear( Character &you )
 {
-    while( !you.queued_effect_on_conditions.empty() ) {
-        you.queued_effect_on_conditions.pop();
-    }
+    you.queued_effect_on_conditions.clear();
     you.inactive_effect_on_condition_vector.clear();
-    while( !g->queued_global_effect_on_conditions.empty() ) {
-        g->queued_global_effect_on_conditions.pop();
-    }
+    g->queued_global_effect_on_conditions.clear();
     g->inactive_global_effect_on_condition_vector.clear();
 }
 
@@ -453,21 +469,18 @@ void effect_on_conditions::write_eocs_to_file( Character &you )
         testfile << "id;timepoint;recurring" << std::endl;
 
         testfile << "queued eocs:" << std::endl;
-        std::vector<queued_eoc> temp_queue;
-        while( !you.queued_effect_on_conditions.empty() ) {
-            temp_queue.push_back( you.queued_effect_on_conditions.top() );
-            you.queued_effect_on_conditions.pop();
-        }
+        std::vector<queued_eoc> temp_queue( you.queued_effect_on_conditions.list.begin(),
+                                            you.queued_effect_on_conditions.list.end() );
+        std::stable_sort( temp_queue.begin(), temp_queue.end(), []( const queued_eoc & lhs,
+        const queued_eoc & rhs ) {
+            return lhs.time < rhs.time;
+        } );
 
         for( const queued_eoc &queue_entry : temp_queue ) {
             time_duration temp = queue_entry.time - calendar::turn;
             testfile << queue_entry.eoc.c_str() << ";" << to_string( temp ) << std::endl;
         }
 
-        for( const queued_eoc &queued : temp_queue ) {
-            you.queued_effect_on_conditions.push( queued );
-        }
-
         testfile << "inactive eocs:" << std::endl;
         for( const effect_on_condition_id &eoc : you.inactive_effect_on_condition_vector ) {
             testfile << eoc.c_str() << std::endl;
@@ -483,21 +496,18 @@ void effect_on_conditions::write_global_eocs_to_file( )
         testfile << "id;timepoint;recurring" << std::endl;
 
         testfile << "queued eocs:" << std::endl;
-        std::vector<queued_eoc> temp_queue;
-        while( !g->queued_global_effect_on_conditions.empty() ) {
-            temp_queue.push_back( g->queued_global_effect_on_conditions.top() );
-            g->queued_global_effect_on_conditions.pop();
-        }
+        std::vector<queued_eoc> temp_queue( g->queued_global_effect_on_conditions.list.begin(),
+                                            g->queued_global_effect_on_conditions.list.end() );
+        std::stable_sort( temp_queue.begin(), temp_queue.end(), []( const queued_eoc & lhs,
+        const queued_eoc & rhs ) {
+            return lhs.time < rhs.time;
+        } );
 
         for( const queued_eoc &queue_entry : temp_queue ) {
             time_duration temp = queue_entry.time - calendar::turn;
             testfile << queue_entry.eoc.c_str() << ";" << to_string( temp ) << std::endl;
         }
 
-        for( const queued_eoc &queued : temp_queue ) {
-            g->queued_global_effect_on_conditions.push( queued );
-        }
-
         testfile << "inactive eocs:" << std::endl;
         for( const effect_on_condition_id &eoc : g->inactive_global_effect_on_condition_vector ) {
             testfile << eoc.c_str() << std::endl;
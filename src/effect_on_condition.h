@@ -19,6 +19,7 @@ class Character;
 class JsonObject;
 class JsonValue;
 class time_duration;
+enum class condition_reads : int;
 enum class event_type : int;
 struct effect_on_condition;
 template <typename E> struct enum_traits;
@@ -64,12 +65,16 @@ struct effect_on_condition {
         bool has_deactivate_condition = false;
         bool has_condition = false;
         bool has_false_effect = false;
+        // What deactivate_condition reads, set when it is loaded.
+        condition_reads deactivate_reads{};
         event_type required_event;
         duration_or_var recurrence;
         bool activate( dialogue &d, bool require_callstack_check = true ) const;
         bool activate_activation_only( dialogue &d, const std::string &text1, const std::string &text2 = "",
                                        const std::string &text3 = "", bool require_callstack_check = true ) const;
         bool check_deactivate( const_dialogue const &d ) const;
+        // Whether a change to `changed` can make check_deactivate fail, reactivating this.
+        bool reactivated_by( condition_reads changed ) const;
         bool test_condition( const_dialogue const &d ) const;
         void apply_true_effects( dialogue &d ) const;
         void load( const JsonObject &jo, std::string_view src );
@@ -100,9 +105,9 @@ void queue_effect_on_condition( time_duration duration, effect_on_condition_id e
                                 Character &you, global_variables::impl_t const &context );
 /** called every turn to process the queued eocs */
 void process_effect_on_conditions( Character &you );
-/** called after certain events to test whether to reactivate eocs */
-void process_reactivate( Character &you );
-void process_reactivate();
+/** called after `changed` changes to test whether to reactivate eocs */
+void process_reactivate( Character &you, condition_reads changed );
+void process_reactivate( condition_reads changed );
 /** clear all queued and inactive eocs */
 void clear( Character &you );
 /** write out all queued eocs and inactive eocs to a file for testing */
@@ -190,9 +190,51 @@ float gurney_spherical( const double charge, const double mass )
                                          -0.5 ) * TYPICAL_GURNEY_CONSTANT );
 }
 
+namespace
+{
+// What the blasts of one batch of explosions did to a tile, summed over all of them.
+struct blast_tile {
+    float force = 0.0f;
+    // The part of force that came from fiery explosions.
+    float fire_force = 0.0f;
+    // The strongest single blast reaching the tile is credited with its damage.
+    float strongest = 0.0f;
+    Creature *source = nullptr;
+};
+
+// Fragments of one explosion passing through a tile.
+struct shrapnel_hit {
+    fragment_cloud cloud;
+    int damage = 0;
+    tripoint_bub_ms origin;
+    Creature *source = nullptr;
+};
+
+// One explosion of a batch. Every queued explosion keeps its own entry, even when another
+// identical one shares its tile: a merged entry with the summed power would blast further and
+// throw its fragments differently than the explosions it replaced.
+struct batched_explosion {
+    tripoint_bub_ms pos;
+    explosion_data data;
+    Creature *source = nullptr;
+};
+} // namespace
+
+static void add_to_batch( std::vector<batched_explosion> &batch, const Creature *source,
+                          const tripoint_bub_ms &p, const explosion_data &ex )
+{
+    // The source may have died since queueing the explosion, so look it up again.
+    Creature *mutable_source = source == nullptr ? nullptr :
+                               get_creature_tracker().creature_at( source->pos_abs() );
+    batch.push_back( { p, ex, mutable_source } );
+}
+
 // (C1001) Compiler Internal Error on Visual Studio 2015 with Update 2
-static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p, const float power,
-                      const float distance_factor, const bool fire )
+// Flood fills the blast of one explosion from p, bashing terrain on the way, and adds its force
+// to every tile it reaches. The fill stays per explosion, as walls shadow each one differently.
+static void propagate_blast( map *m, Creature *source, const tripoint_bub_ms &p,
+                             const float power, const float distance_factor, const bool fire,
+                             std::map<tripoint_bub_ms, blast_tile> &blasted )
 {
     const float tile_dist = 1.0f;
     const float diag_dist = trigdist ? M_SQRT2 * tile_dist : 1.0f * tile_dist;
@@ -304,11 +346,28 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
         }
     }
 
-    // Draw the explosion, but only if the explosion center is within the reality bubble
+    for( const tripoint_bub_ms &pt : closed ) {
+        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+        blast_tile &tile = blasted[pt];
+        tile.force += force;
+        if( fire ) {
+            tile.fire_force += force;
+        }
+        if( force > tile.strongest ) {
+            tile.strongest = force;
+            tile.source = source;
+        }
+    }
+}
+
+// Draws the summed blasts of a batch and applies their effects, once per tile.
+static void apply_blasts( map *m, const std::map<tripoint_bub_ms, blast_tile> &blasted,
+                          const bool draw )
+{
     map &bubble_map = reality_bubble();
-    if( bubble_map.inbounds( m->get_abs( p ) ) ) {
+    if( draw ) {
         std::map<tripoint_bub_ms, nc_color> explosion_colors;
-        for( const tripoint_bub_ms &pt : closed ) {
+        for( const auto &[pt, tile] : blasted ) {
             const tripoint_bub_ms bubble_pos( bubble_map.get_bub( m->get_abs( pt ) ) );
 
             if( !bubble_map.inbounds( bubble_pos ) ) {
@@ -318,11 +377,10 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
                 continue;
             }
 
-            const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
             nc_color col = c_red;
-            if( force < 10 ) {
+            if( tile.force < 10 ) {
                 col = c_white;
-            } else if( force < 30 ) {
+            } else if( tile.force < 30 ) {
                 col = c_yellow;
             }
 
@@ -333,9 +391,8 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
     }
 
     creature_tracker &creatures = get_creature_tracker();
-    Creature *mutable_source = source == nullptr ? nullptr : creatures.creature_at( source->pos_abs() );
-    for( const tripoint_bub_ms &pt : closed ) {
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+    for( const auto &[pt, tile] : blasted ) {
+        const float force = tile.force;
         if( force < 1.0f ) {
             // Too weak to matter
             continue;
@@ -345,20 +402,30 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
             m->smash_items( pt, force, _( "force of the explosion" ) );
         }
 
-        if( fire ) {
-            int intensity = ( force > 50.0f ) + ( force > 100.0f );
-            if( force > 10.0f || x_in_y( force, 10.0f ) ) {
+        if( tile.fire_force > 0.0f ) {
+            const float fire_force = tile.fire_force;
+            int intensity = ( fire_force > 50.0f ) + ( fire_force > 100.0f );
+            if( fire_force > 10.0f || x_in_y( fire_force, 10.0f ) ) {
                 intensity++;
             }
             m->add_field( pt, fd_fire, intensity );
         }
 
-        if( const optional_vpart_position vp = m->veh_at( pt ) ) {
-            // TODO: Make this weird unit used by vehicle::damage more sensible
-            vp->vehicle().damage( *m, vp->part_index(), force,
-                                  fire ? damage_heat : damage_bash, false );
+        // TODO: Make this weird unit used by vehicle::damage more sensible
+        const float bash_force = force - tile.fire_force;
+        if( bash_force > 0.0f ) {
+            if( const optional_vpart_position vp = m->veh_at( pt ) ) {
+                vp->vehicle().damage( *m, vp->part_index(), bash_force, damage_bash, false );
+            }
+        }
+        // Looked up again, the bash may have destroyed the part.
+        if( tile.fire_force > 0.0f ) {
+            if( const optional_vpart_position vp = m->veh_at( pt ) ) {
+                vp->vehicle().damage( *m, vp->part_index(), tile.fire_force, damage_heat, false );
+            }
         }
 
+        Creature *const mutable_source = tile.source;
         const tripoint_abs_ms pt_abs = m->get_abs( pt );
         Creature *critter = creatures.creature_at( pt_abs, true );
         if( critter == nullptr ) {
@@ -421,103 +488,160 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
     }
 }
 
-static std::vector<tripoint_bub_ms> shrapnel( map *m, const Creature *source,
-        const tripoint_bub_ms &src, int power,
-        int casing_mass, float per_fragment_mass, int range = -1 )
+// Fragments from every explosion of a batch that hit one tile, applied together.
+static void apply_shrapnel_hits( map *m, const tripoint_bub_ms &target,
+                                 const std::vector<shrapnel_hit> &hits )
 {
-    // The gurney equation wants the total mass of the casing.
-    const float fragment_velocity = gurney_spherical( power, casing_mass );
-    fragment_mass = per_fragment_mass;
-    fragment_area = mass_to_area( fragment_mass );
-    int fragment_count = casing_mass / fragment_mass;
-
-    // Contains all tiles reached by fragments.
-    std::vector<tripoint_bub_ms> distrib;
-
     projectile proj;
-    proj.speed = fragment_velocity;
-    proj.range = range;
+    proj.range = -1;
     proj.proj_effects.insert( ammo_effect_NULL_SOURCE );
 
-    struct local_caches {
-        cata::mdarray<fragment_cloud, point_bub_ms> obstacle_cache;
-        cata::mdarray<fragment_cloud, point_bub_ms> visited_cache;
-    };
-
-    std::unique_ptr<local_caches> caches = std::make_unique<local_caches>();
-    cata::mdarray<fragment_cloud, point_bub_ms> &obstacle_cache = caches->obstacle_cache;
-    cata::mdarray<fragment_cloud, point_bub_ms> &visited_cache = caches->visited_cache;
-
-    // TODO: Calculate range based on max effective range for projectiles.
-    // Basically bisect between 0 and map diameter using shrapnel_calc().
-    // Need to update shadowcasting to support limiting range without adjusting initial distance.
-    const tripoint_range<tripoint_bub_ms> area = m->points_on_zlevel( src.z() );
-
-    m->build_obstacle_cache( area.min(), area.max() + tripoint::south_east, obstacle_cache );
-
-    // Shadowcasting normally ignores the origin square,
-    // so apply it manually to catch monsters standing on the explosive.
-    // This "blocks" some fragments, but does not apply deceleration.
-    fragment_cloud initial_cloud = accumulate_fragment_cloud( obstacle_cache[src.x()][src.y()],
-    { fragment_velocity, static_cast<float>( fragment_count ) }, 1 );
-    visited_cache[src.x()][src.y()] = initial_cloud;
-    visited_cache[src.x()][src.y()].density = static_cast<float>( fragment_count / 2.0 );
-
-    castLightAll<fragment_cloud, fragment_cloud, shrapnel_calc, shrapnel_check,
-                 update_fragment_cloud, accumulate_fragment_cloud>
-                 ( visited_cache, obstacle_cache, src.xy(), 0, initial_cloud );
+    int damage = 0;
+    for( const shrapnel_hit &hit : hits ) {
+        damage += hit.damage;
+    }
 
     creature_tracker &creatures = get_creature_tracker();
-    Creature *mutable_source = source == nullptr ? nullptr : creatures.creature_at( source->pos_abs() );
-    // Now visited_caches are populated with density and velocity of fragments.
-    for( const tripoint_bub_ms &target : area ) {
-        fragment_cloud &cloud = visited_cache[target.x()][target.y()];
-        if( cloud.density <= MIN_FRAGMENT_DENSITY ||
-            cloud.velocity <= MIN_EFFECTIVE_VELOCITY ) {
-            continue;
-        }
-        distrib.emplace_back( target );
-        int damage = ballistic_damage( cloud.velocity, fragment_mass );
-        const tripoint_abs_ms abs_target = m->get_abs( target );
-        Creature *critter = creatures.creature_at( abs_target );
-        if( damage > 0 && critter && !critter->is_dead_state() ) {
-            std::poisson_distribution<> d( cloud.density );
-            int hits = d( rng_get_engine() );
-            dealt_projectile_attack frag;
-            frag.proj = proj;
-            frag.shrapnel = true;
-            frag.proj.speed = cloud.velocity;
-            frag.proj.impact = damage_instance( damage_bullet, damage );
-
-            weakpoint_attack wp_attack;
-            wp_attack.type = weakpoint_attack::attack_type::PROJECTILE;
-            wp_attack.target = critter;
-            wp_attack.accuracy = 0.f;
-
-            for( int i = 0; i < hits; ++i ) {
+    const tripoint_abs_ms abs_target = m->get_abs( target );
+    Creature *critter = creatures.creature_at( abs_target );
+    if( damage > 0 && critter && !critter->is_dead_state() ) {
+        dealt_projectile_attack frag;
+        frag.proj = proj;
+        frag.shrapnel = true;
+
+        weakpoint_attack wp_attack;
+        wp_attack.type = weakpoint_attack::attack_type::PROJECTILE;
+        wp_attack.target = critter;
+        wp_attack.accuracy = 0.f;
+
+        for( const shrapnel_hit &hit : hits ) {
+            if( hit.damage <= 0 ) {
+                continue;
+            }
+            std::poisson_distribution<> d( hit.cloud.density );
+            int hit_count = d( rng_get_engine() );
+            frag.proj.speed = hit.cloud.velocity;
+            frag.proj.impact = damage_instance( damage_bullet, hit.damage );
+
+            for( int i = 0; i < hit_count; ++i ) {
                 frag.missed_by = rng_float( 0.05, 1.0 / critter->ranged_target_size() );
-                critter->deal_projectile_attack( m, mutable_source, frag, frag.missed_by, false, wp_attack );
+                critter->deal_projectile_attack( m, hit.source, frag, frag.missed_by, false,
+                                                 wp_attack );
 
                 add_msg_debug( debugmode::DF_EXPLOSION, "Shrapnel hit %s at %d m/s at a distance of %d",
                                critter->disp_name(),
-                               frag.proj.speed, rl_dist( src, target ) );
-                add_msg_debug( debugmode::DF_EXPLOSION, "Shrapnel dealt %d damage", frag.dealt_dam.total_damage() );
+                               frag.proj.speed, rl_dist( hit.origin, target ) );
+                add_msg_debug( debugmode::DF_EXPLOSION, "Shrapnel dealt %d damage",
+                               frag.dealt_dam.total_damage() );
                 if( critter->is_dead_state() ) {
                     break;
                 }
             }
-            auto it = frag.targets_hit[critter];
-            if( reality_bubble().inbounds(
-                    abs_target ) ) { // Only report on critters in the reality bubble. Should probably be only for visible critters...
-                multi_projectile_hit_message( critter, it.first, it.second, n_gettext( "bomb fragment",
-                                              "bomb fragments", it.first ) );
+            if( critter->is_dead_state() ) {
+                break;
             }
         }
-        if( m->impassable( target ) ) {
-            if( optional_vpart_position vp = m->veh_at( target ) ) {
-                vp->vehicle().damage( *m, vp->part_index(), damage / 10 );
-            } else {
-                m->bash( target, damage / 100, true );
+        auto it = frag.targets_hit[critter];
+        // Only report on critters in the reality bubble.
+        // Should probably be only for visible critters...
+        if( reality_bubble().inbounds( abs_target ) ) {
+            multi_projectile_hit_message( critter, it.first, it.second, n_gettext( "bomb fragment",
+                                          "bomb fragments", it.first ) );
+        }
+    }
+    if( m->impassable( target ) ) {
+        if( optional_vpart_position vp = m->veh_at( target ) ) {
+            vp->vehicle().damage( *m, vp->part_index(), damage / 10 );
+        } else {
+            m->bash( target, damage / 100, true );
+        }
+    }
+}
+
+// Casts the fragments of every explosion of the batch, then applies the hits once per tile.
+// Returns the tiles reached by the fragments of each explosion, in batch order.
+static std::vector<std::vector<tripoint_bub_ms>> shrapnel( map *m,
+        const std::vector<batched_explosion> &batch )
+{
+    // Contains all tiles reached by fragments, per explosion.
+    std::vector<std::vector<tripoint_bub_ms>> distrib( batch.size() );
+
+    struct local_caches {
+        cata::mdarray<fragment_cloud, point_bub_ms> obstacle_cache;
+        cata::mdarray<fragment_cloud, point_bub_ms> visited_cache;
+    };
+
+    std::unique_ptr<local_caches> caches = std::make_unique<local_caches>();
+    cata::mdarray<fragment_cloud, point_bub_ms> &obstacle_cache = caches->obstacle_cache;
+    cata::mdarray<fragment_cloud, point_bub_ms> &visited_cache = caches->visited_cache;
+    // Nothing changes obstacles until the hits are applied, so every explosion on a z-level
+    // shares one obstacle cache.
+    std::optional<int> obstacle_z;
+    bool visited_dirty = false;
+
+    std::map<tripoint_bub_ms, std::vector<shrapnel_hit>> hits;
+    std::set<int> hit_zlevels;
+    for( size_t i = 0; i < batch.size(); ++i ) {
+        const explosion_data &ex = batch[i].data;
+        const tripoint_bub_ms &src = batch[i].pos;
+        const int power = ex.power;
+        const int casing_mass = ex.shrapnel.casing_mass;
+        if( casing_mass <= 0 ) {
+            continue;
+        }
+        // The gurney equation wants the total mass of the casing.
+        const float fragment_velocity = gurney_spherical( power, casing_mass );
+        fragment_mass = ex.shrapnel.fragment_mass;
+        fragment_area = mass_to_area( fragment_mass );
+        int fragment_count = casing_mass / fragment_mass;
+
+        // TODO: Calculate range based on max effective range for projectiles.
+        // Basically bisect between 0 and map diameter using shrapnel_calc().
+        // Need to update shadowcasting to support limiting range without adjusting initial
+        // distance.
+        const tripoint_range<tripoint_bub_ms> area = m->points_on_zlevel( src.z() );
+
+        if( obstacle_z != src.z() ) {
+            m->build_obstacle_cache( area.min(), area.max() + tripoint::south_east,
+                                     obstacle_cache );
+            obstacle_z = src.z();
+        }
+        if( visited_dirty ) {
+            visited_cache.fill( fragment_cloud() );
+        }
+        visited_dirty = true;
+
+        // Shadowcasting normally ignores the origin square,
+        // so apply it manually to catch monsters standing on the explosive.
+        // This "blocks" some fragments, but does not apply deceleration.
+        fragment_cloud initial_cloud = accumulate_fragment_cloud( obstacle_cache[src.x()][src.y()],
+        { fragment_velocity, static_cast<float>( fragment_count ) }, 1 );
+        visited_cache[src.x()][src.y()] = initial_cloud;
+        visited_cache[src.x()][src.y()].density = static_cast<float>( fragment_count / 2.0 );
+
+        castLightAll<fragment_cloud, fragment_cloud, shrapnel_calc, shrapnel_check,
+                     update_fragment_cloud, accumulate_fragment_cloud>
+                     ( visited_cache, obstacle_cache, src.xy(), 0, initial_cloud );
+
+        // Now visited_caches are populated with density and velocity of fragments.
+        for( const tripoint_bub_ms &target : area ) {
+            const fragment_cloud &cloud = visited_cache[target.x()][target.y()];
+            if( cloud.density <= MIN_FRAGMENT_DENSITY ||
+                cloud.velocity <= MIN_EFFECTIVE_VELOCITY ) {
+                continue;
+            }
+            distrib[i].emplace_back( target );
+            hits[target].push_back( { cloud, ballistic_damage( cloud.velocity, fragment_mass ), src,
+                                      batch[i].source } );
+            hit_zlevels.insert( target.z() );
+        }
+    }
+
+    for( const int z : hit_zlevels ) {
+        for( const tripoint_bub_ms &target : m->points_on_zlevel( z ) ) {
+            const auto found = hits.find( target );
+            if( found != hits.end() ) {
+                apply_shrapnel_hits( m, target, found->second );
             }
         }
     }
@@ -567,48 +691,57 @@ void explosion( const Creature *source, map *here, const tripoint_bub_ms &p,
     _explosions.emplace_back( source, here->get_abs( p ), ex );
 }
 
-void _make_explosion( map *m, const Creature *source, const tripoint_bub_ms &p,
-                      const explosion_data &ex )
+// Sets off a batch of explosions on m at once: the blasts propagate per explosion but their
+// force is summed per tile, fragments are cast per explosion and then applied per tile, so
+// each tile, creature and vehicle part takes the damage of the whole batch in one go.
+static void make_explosions( map *m, const std::vector<batched_explosion> &batch )
 {
     map &bubble_map = reality_bubble();
 
-    if( bubble_map.inbounds( m->get_abs( p ) ) ) {
-        tripoint_bub_ms bubble_pos = bubble_map.get_bub( m->get_abs( p ) );
-        int noise = ex.power * ( ex.fire ? 2 : 10 );
-        noise = ( noise > ex.max_noise ) ? ex.max_noise : noise;
-
-        if( noise >= 30 ) {
-            sounds::sound( bubble_pos, noise, sounds::sound_t::combat, _( "a huge explosion!" ), false,
-                           "explosion",
-                           "huge" );
-        } else if( noise >= 4 ) {
-            sounds::sound( bubble_pos, noise, sounds::sound_t::combat, _( "an explosion!" ), false, "explosion",
-                           "default" );
-        } else if( noise > 0 ) {
-            sounds::sound( bubble_pos, 3, sounds::sound_t::combat, _( "a loud pop!" ), false, "explosion",
-                           "small" );
+    std::map<tripoint_bub_ms, blast_tile> blasted;
+    bool draw = false;
+    for( const batched_explosion &queued : batch ) {
+        const explosion_data &ex = queued.data;
+        const tripoint_bub_ms &p = queued.pos;
+        if( bubble_map.inbounds( m->get_abs( p ) ) ) {
+            tripoint_bub_ms bubble_pos = bubble_map.get_bub( m->get_abs( p ) );
+            int noise = ex.power * ( ex.fire ? 2 : 10 );
+            noise = ( noise > ex.max_noise ) ? ex.max_noise : noise;
+
+            if( noise >= 30 ) {
+                sounds::sound( bubble_pos, noise, sounds::sound_t::combat, _( "a huge explosion!" ),
+                               false, "explosion", "huge" );
+            } else if( noise >= 4 ) {
+                sounds::sound( bubble_pos, noise, sounds::sound_t::combat, _( "an explosion!" ),
+                               false, "explosion", "default" );
+            } else if( noise > 0 ) {
+                sounds::sound( bubble_pos, 3, sounds::sound_t::combat, _( "a loud pop!" ), false,
+                               "explosion", "small" );
+            }
         }
-    }
 
-    if( ex.distance_factor >= 1.0f ) {
-        debugmsg( "called game::explosion with factor >= 1.0 (infinite size)" );
-    } else if( ex.distance_factor > 0.0f && ex.power > 0.0f ) {
-        // Power rescaled to mean grams of TNT equivalent, this scales it roughly back to where
-        // it was before until we re-do blasting power to be based on TNT-equivalent directly.
-        do_blast( m, source, p, ex.power / 15.0, ex.distance_factor, ex.fire );
+        if( ex.distance_factor >= 1.0f ) {
+            debugmsg( "called game::explosion with factor >= 1.0 (infinite size)" );
+        } else if( ex.distance_factor > 0.0f && ex.power > 0.0f ) {
+            // Power rescaled to mean grams of TNT equivalent, this scales it roughly back to where
+            // it was before until we re-do blasting power to be based on TNT-equivalent directly.
+            propagate_blast( m, queued.source, p, ex.power / 15.0, ex.distance_factor, ex.fire,
+                             blasted );
+            // Draw the explosion, but only if the explosion center is within the reality bubble
+            draw = draw || bubble_map.inbounds( m->get_abs( p ) );
+        }
     }
+    apply_blasts( m, blasted, draw );
 
-    const shrapnel_data &shr = ex.shrapnel;
-    if( shr.casing_mass > 0 ) {
-        std::vector<tripoint_bub_ms> shrapnel_locations = shrapnel( m, source, p, ex.power, shr.casing_mass,
-                shr.fragment_mass );
-
+    const std::vector<std::vector<tripoint_bub_ms>> shrapnel_locations = shrapnel( m, batch );
+    for( size_t i = 0; i < batch.size(); ++i ) {
+        const shrapnel_data &shr = batch[i].data.shrapnel;
         // If explosion drops shrapnel...
-        if( shr.recovery > 0 && !shr.drop.is_null() ) {
+        if( shr.casing_mass > 0 && shr.recovery > 0 && !shr.drop.is_null() ) {
 
             // Extract only passable tiles affected by shrapnel
             std::vector<tripoint_bub_ms> tiles;
-            for( const tripoint_bub_ms &e : shrapnel_locations ) {
+            for( const tripoint_bub_ms &e : shrapnel_locations[i] ) {
                 if( m->passable( e ) ) {
                     tiles.push_back( e );
                 }
@@ -627,6 +760,14 @@ void _make_explosion( map *m, const Creature *source, const tripoint_bub_ms &p,
     }
 }
 
+void _make_explosion( map *m, const Creature *source, const tripoint_bub_ms &p,
+                      const explosion_data &ex )
+{
+    std::vector<batched_explosion> batch;
+    add_to_batch( batch, source, p, ex );
+    make_explosions( m, batch );
+}
+
 void flashbang( const tripoint_bub_ms &p, bool player_immune, const int radius )
 {
 
@@ -1011,13 +1152,21 @@ void process_explosions()
     std::vector<queued_explosion> explosions_copy( _explosions );
     _explosions.clear();
 
+    // Consecutive explosions fitting in the reality bubble go off together, so that a chain
+    // reaction propagates and applies its damage once instead of once per explosive. One
+    // needing its own map ends the batch, so explosions still go off in the order queued.
+    map *bubble_map = &reality_bubble();
+    std::vector<batched_explosion> in_bubble;
     for( const queued_explosion &ex : explosions_copy ) {
         const int safe_range = ex.data.safe_range();
-        map  *bubble_map = &reality_bubble();
         const tripoint_bub_ms bubble_pos( bubble_map->get_bub( ex.pos ) );
 
         if( bubble_pos.x() - safe_range < 0 || bubble_pos.x() + safe_range > MAPSIZE_X ||
             bubble_pos.y() - safe_range < 0 || bubble_pos.y() + safe_range > MAPSIZE_Y ) {
+            if( !in_bubble.empty() ) {
+                make_explosions( bubble_map, in_bubble );
+                in_bubble.clear();
+            }
             map m;
             const tripoint_abs_sm origo( project_to<coords::sm>( ex.pos ) - point_rel_sm{ HALF_MAPSIZE, HALF_MAPSIZE} );
             // Create a map centered around the explosion point to allow an explosion with a radius of up to 5 submaps
@@ -1033,9 +1182,12 @@ void process_explosions()
             _make_explosion( &m, ex.source.get(), m.get_bub( ex.pos ), ex.data );
             m.process_falling();
         } else {
-            _make_explosion( bubble_map, ex.source.get(), bubble_map->get_bub( ex.pos ), ex.data );
+            add_to_batch( in_bubble, ex.source.get(), bubble_pos, ex.data );
         }
     }
+    if( !in_bubble.empty() ) {
+        make_explosions( bubble_map, in_bubble );
+    }
 }
 
 } // namespace explosion_handler
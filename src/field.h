@@ -92,6 +92,23 @@ class field_entry
         void initialize_decay();
         void do_decay();
 
+        // Remember the current intensity and age as the state this field started
+        // the map::process_fields step with.
+        void begin_step() {
+            step_intensity = is_field_alive() ? intensity : 0;
+            step_age = age;
+        }
+        // Intensity and age at the start of the current map::process_fields step.
+        // Other tiles read these rather than the live values, so it does not matter
+        // whether this tile has been processed yet. Fields created during the step
+        // have a step intensity of 0.
+        int get_step_intensity() const {
+            return step_intensity;
+        }
+        time_duration get_step_age() const {
+            return step_age;
+        }
+
         std::vector<field_effect> field_effects() const;
 
     private:
@@ -107,6 +124,9 @@ class field_entry
         time_point decay_time;
         // True if this is an active field, false if it should be destroyed next check.
         bool is_alive;
+        // See begin_step.
+        int step_intensity = 0;
+        time_duration step_age = 0_turns;
 };
 
 /**
@@ -730,6 +730,8 @@ void game::setup()
     // reset follower list
     scent.reset();
     effect_on_conditions::clear( u );
+    // Forget what the previous world looked like, and the tile ids it used.
+    u.clear_map_memory();
     u.character_mood_face( true );
     remoteveh_cache_time = calendar::before_time_starts;
     remoteveh_cache = nullptr;
@@ -10292,6 +10294,9 @@ point_rel_sm game::update_map( int &x, int &y, bool z_level_changed )
     // Update what parts of the world map we can see
     update_overmap_seen();
 
+    // Get a head start on the overmap we might be heading into
+    overmap_buffer.prefetch_near( u.pos_abs_omt() );
+
     return shift;
 }
 
@@ -1290,6 +1290,10 @@ class game
         bool critter_died = false; // NOLINT(cata-serialize)
         /** Is this the first redraw since waiting (sleeping or activity) started */
         bool first_redraw_since_waiting_started = true; // NOLINT(cata-serialize)
+        /** Did a redraw of the main UI while waiting fall on a skipped fast-forward frame */
+        bool wait_main_redraw_owed = false; // NOLINT(cata-serialize)
+        /** Did a redraw during auto-travel fall on a skipped fast-forward frame */
+        bool travel_redraw_owed = false; // NOLINT(cata-serialize)
         /** Is Zone manager open or not - changes graphics of some zone tiles */
         bool zones_manager_open = false; // NOLINT(cata-serialize)
 
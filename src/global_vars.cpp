@@ -0,0 +1,205 @@
+#include "global_vars.h"
+
+#include <algorithm>
+
+namespace
+{
+
+struct var_slot_table {
+    std::unordered_map<std::string, uint32_t> slots;
+};
+
+var_slot_table &get_var_slot_table()
+{
+    static var_slot_table table;
+    return table;
+}
+
+bool slot_less( const std::pair<uint32_t, diag_value const *> &entry, uint32_t slot )
+{
+    return entry.first < slot;
+}
+
+} // namespace
+
+uint32_t var_slots::intern( const std::string &name )
+{
+    std::unordered_map<std::string, uint32_t> &slots = get_var_slot_table().slots;
+    return slots.emplace( name, static_cast<uint32_t>( slots.size() ) ).first->second;
+}
+
+uint32_t var_slots::find( const std::string &name )
+{
+    const std::unordered_map<std::string, uint32_t> &slots = get_var_slot_table().slots;
+    const auto it = slots.find( name );
+    return it == slots.end() ? none : it->second;
+}
+
+uint32_t var_slots::count()
+{
+    return static_cast<uint32_t>( get_var_slot_table().slots.size() );
+}
+
+diag_var_map::diag_var_map( diag_var_map &&other ) noexcept : vars( std::move( other.vars ) ),
+    slots( std::move( other.slots ) ), indexed_names( other.indexed_names )
+{
+    other.slots.clear();
+    other.indexed_names = 0;
+}
+
+diag_var_map &diag_var_map::operator=( const diag_var_map &other )
+{
+    if( this != &other ) {
+        vars = other.vars;
+        slots.clear();
+        indexed_names = 0;
+    }
+    return *this;
+}
+
+diag_var_map &diag_var_map::operator=( diag_var_map &&other ) noexcept
+{
+    if( this != &other ) {
+        vars = std::move( other.vars );
+        slots = std::move( other.slots );
+        indexed_names = other.indexed_names;
+        other.slots.clear();
+        other.indexed_names = 0;
+    }
+    return *this;
+}
+
+diag_value const *diag_var_map::find_slot( uint32_t slot ) const
+{
+    if( slot >= indexed_names ) {
+        reindex();
+    }
+    const auto it = std::lower_bound( slots.begin(), slots.end(), slot, slot_less );
+    return it != slots.end() && it->first == slot ? it->second : nullptr;
+}
+
+diag_value &diag_var_map::operator[]( const std::string &key )
+{
+    std::pair<iterator, bool> ret = vars.try_emplace( key );
+    if( ret.second ) {
+        index( *ret.first );
+    }
+    return ret.first->second;
+}
+
+diag_value &diag_var_map::operator[]( std::string &&key )
+{
+    std::pair<iterator, bool> ret = vars.try_emplace( std::move( key ) );
+    if( ret.second ) {
+        index( *ret.first );
+    }
+    return ret.first->second;
+}
+
+std::pair<diag_var_map::iterator, bool> diag_var_map::insert( const value_type &v )
+{
+    std::pair<iterator, bool> ret = vars.insert( v );
+    if( ret.second ) {
+        index( *ret.first );
+    }
+    return ret;
+}
+
+std::pair<diag_var_map::iterator, bool> diag_var_map::insert( value_type &&v )
+{
+    std::pair<iterator, bool> ret = vars.insert( std::move( v ) );
+    if( ret.second ) {
+        index( *ret.first );
+    }
+    return ret;
+}
+
+diag_var_map::insert_return_type diag_var_map::insert( node_type &&node )
+{
+    insert_return_type ret = vars.insert( std::move( node ) );
+    if( ret.inserted ) {
+        index( *ret.position );
+    }
+    return ret;
+}
+
+diag_var_map::size_type diag_var_map::erase( const std::string &key )
+{
+    const auto it = vars.find( key );
+    if( it == vars.end() ) {
+        return 0;
+    }
+    erase( it );
+    return 1;
+}
+
+diag_var_map::iterator diag_var_map::erase( const_iterator pos )
+{
+    unindex( pos->second );
+    return vars.erase( pos );
+}
+
+diag_var_map::iterator diag_var_map::erase( iterator pos )
+{
+    return erase( const_iterator( pos ) );
+}
+
+diag_var_map::node_type diag_var_map::extract( const_iterator pos )
+{
+    unindex( pos->second );
+    return vars.extract( pos );
+}
+
+diag_var_map::node_type diag_var_map::extract( const std::string &key )
+{
+    const auto it = vars.find( key );
+    return it == vars.end() ? node_type() : extract( it );
+}
+
+void diag_var_map::clear() noexcept
+{
+    vars.clear();
+    slots.clear();
+    indexed_names = 0;
+}
+
+void diag_var_map::swap( diag_var_map &other ) noexcept
+{
+    vars.swap( other.vars );
+    slots.swap( other.slots );
+    std::swap( indexed_names, other.indexed_names );
+}
+
+void diag_var_map::index( const value_type &v ) const
+{
+    const uint32_t slot = var_slots::find( v.first );
+    if( slot == var_slots::none ) {
+        return;
+    }
+    slots.emplace( std::lower_bound( slots.begin(), slots.end(), slot, slot_less ), slot,
+                   &v.second );
+}
+
+void diag_var_map::unindex( const diag_value &v )
+{
+    const auto it = std::find_if( slots.begin(), slots.end(),
+    [&v]( const std::pair<uint32_t, diag_value const *> &entry ) {
+        return entry.second == &v;
+    } );
+    if( it != slots.end() ) {
+        slots.erase( it );
+    }
+}
+
+void diag_var_map::reindex() const
+{
+    slots.clear();
+    indexed_names = var_slots::count();
+    for( const value_type &v : vars ) {
+        const uint32_t slot = var_slots::find( v.first );
+        if( slot != var_slots::none ) {
+            slots.emplace_back( slot, &v.second );
+        }
+    }
+    std::sort( slots.begin(), slots.end() );
+}
@@ -2,14 +2,149 @@
 #ifndef CATA_SRC_GLOBAL_VARS_H
 #define CATA_SRC_GLOBAL_VARS_H
 
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "math_parser_diag_value.h"
 
 #include "json.h"
 
+// Variable names that loaded JSON refers to get a small integer slot, so that reading them
+// through a var_info doesn't hash the name on every access. Names built at runtime don't get
+// one and are looked up by string.
+namespace var_slots
+{
+constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+// Returns the slot of name, handing out the next one if it has none yet.
+uint32_t intern( const std::string &name );
+// Returns the slot of name, or none if it was never interned.
+uint32_t find( const std::string &name );
+// Number of slots handed out so far.
+uint32_t count();
+} // namespace var_slots
+
+// String keyed variable storage, as before, plus an index from slot to value for the keys
+// whose names are interned. The map is private, and only the calls that keep the index in step
+// are exposed; values can still be changed in place through iterators, since the index points
+// at them. The index is rebuilt lazily, after copies and whenever a name is interned after this
+// map last indexed its keys.
+class diag_var_map
+{
+        using base = std::unordered_map<std::string, diag_value>;
+    public:
+        using key_type = base::key_type;
+        using mapped_type = base::mapped_type;
+        using value_type = base::value_type;
+        using hasher = base::hasher;
+        using size_type = base::size_type;
+        using iterator = base::iterator;
+        using const_iterator = base::const_iterator;
+        using node_type = base::node_type;
+        using insert_return_type = base::insert_return_type;
+
+        diag_var_map() = default;
+        diag_var_map( std::initializer_list<value_type> init ) : vars( init ) {}
+        diag_var_map( const diag_var_map &other ) : vars( other.vars ) {}
+        diag_var_map( diag_var_map &&other ) noexcept;
+        diag_var_map &operator=( const diag_var_map &other );
+        diag_var_map &operator=( diag_var_map &&other ) noexcept;
+        ~diag_var_map() = default;
+
+        // The value of the variable whose name was interned as slot, if there is one.
+        diag_value const *find_slot( uint32_t slot ) const;
+
+        iterator begin() noexcept {
+            return vars.begin();
+        }
+        const_iterator begin() const noexcept {
+            return vars.begin();
+        }
+        const_iterator cbegin() const noexcept {
+            return vars.cbegin();
+        }
+        iterator end() noexcept {
+            return vars.end();
+        }
+        const_iterator end() const noexcept {
+            return vars.end();
+        }
+        const_iterator cend() const noexcept {
+            return vars.cend();
+        }
+        bool empty() const noexcept {
+            return vars.empty();
+        }
+        size_type size() const noexcept {
+            return vars.size();
+        }
+        iterator find( const std::string &key ) {
+            return vars.find( key );
+        }
+        const_iterator find( const std::string &key ) const {
+            return vars.find( key );
+        }
+        size_type count( const std::string &key ) const {
+            return vars.count( key );
+        }
+        diag_value &at( const std::string &key ) {
+            return vars.at( key );
+        }
+        const diag_value &at( const std::string &key ) const {
+            return vars.at( key );
+        }
+
+        diag_value &operator[]( const std::string &key );
+        diag_value &operator[]( std::string &&key );
+        std::pair<iterator, bool> insert( const value_type &v );
+        std::pair<iterator, bool> insert( value_type &&v );
+        insert_return_type insert( node_type &&node );
+        template<typename... Args>
+        std::pair<iterator, bool> emplace( Args &&... args ) {
+            std::pair<iterator, bool> ret = vars.emplace( std::forward<Args>( args )... );
+            if( ret.second ) {
+                index( *ret.first );
+            }
+            return ret;
+        }
+        size_type erase( const std::string &key );
+        iterator erase( const_iterator pos );
+        iterator erase( iterator pos );
+        node_type extract( const_iterator pos );
+        node_type extract( const std::string &key );
+        void clear() noexcept;
+        void swap( diag_var_map &other ) noexcept;
+
+        bool operator==( const diag_var_map &rhs ) const {
+            return vars == rhs.vars;
+        }
+        bool operator!=( const diag_var_map &rhs ) const {
+            return vars != rhs.vars;
+        }
+
+    private:
+        base vars;
+        // Sorted by slot. Values live in the nodes of the map, which don't move on rehash.
+        // Slots are handed out for every name any loaded JSON mentions, while a map holds a
+        // handful of them, so a vector indexed by slot would cost every creature and item
+        // thousands of empty entries.
+        mutable std::vector<std::pair<uint32_t, diag_value const *>> slots;
+        // Every key whose slot is below this is in slots.
+        mutable uint32_t indexed_names = 0;
+
+        void index( const value_type &v ) const;
+        void unindex( const diag_value &v );
+        void reindex() const;
+};
+
 class global_variables
 {
     public:
-        using impl_t = std::unordered_map<std::string, diag_value>;
+        using impl_t = diag_var_map;
 
         // Methods for setting/getting misc key/value pairs.
         void set_global_value( const std::string &key, diag_value value ) {
@@ -33,11 +168,22 @@ class global_variables
             return _common_get_value( key, global_values );
         }
 
+        diag_value const *maybe_get_global_value( const std::string &key, uint32_t slot ) const {
+            return _common_maybe_get_value( key, slot, global_values );
+        }
+
         static diag_value const *_common_maybe_get_value( const std::string &key, const impl_t &cont ) {
             auto it = cont.find( key );
             return it == cont.end() ? nullptr : &it->second;
         }
 
+        // Looks key up by its slot, or by string if it has none.
+        static diag_value const *_common_maybe_get_value( const std::string &key, uint32_t slot,
+                const impl_t &cont ) {
+            return slot == var_slots::none ? _common_maybe_get_value( key, cont ) :
+                   cont.find_slot( slot );
+        }
+
         static diag_value const &_common_get_value( const std::string &key, const impl_t &cont ) {
             static diag_value const null_val;
             diag_value const *ret = _common_maybe_get_value( key, cont );
@@ -457,7 +457,11 @@ input_context game::get_player_input( std::string &action )
                 g->invalidate_main_ui_adaptor();
             }
 
-            ui_manager::redraw_invalidated();
+            // The death cam does not wait for input, so it runs at the
+            // fast-forward frame rate.
+            if( uquit != QUIT_WATCH || ui_manager::fast_forward_frame_due() ) {
+                ui_manager::redraw_invalidated();
+            }
         } while( handle_mouseview( ctxt, action ) && uquit != QUIT_WATCH
                  && ( action != "TIMEOUT" || !current_turn.has_timeout_elapsed() ) );
         ctxt.reset_timeout();
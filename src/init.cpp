@@ -643,6 +643,7 @@ void DynamicDataLoader::load_all_from_json( const JsonValue &jsin, const std::st
 void DynamicDataLoader::unload_data()
 {
     finalized = false;
+    generation++;
 
     achievement::reset();
     activity_type::reset();
@@ -947,6 +948,7 @@ void DynamicDataLoader::finalize_loaded_data()
         check_consistency();
     }
     finalized = true;
+    generation++;
 }
 
 void DynamicDataLoader::check_consistency()
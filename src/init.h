@@ -64,6 +64,7 @@ class DynamicDataLoader
 
     private:
         bool finalized = false;
+        int generation = 0;
 
         struct cached_streams;
 
@@ -190,6 +191,14 @@ class DynamicDataLoader
             return finalized;
         }
 
+        /**
+         * Changes whenever data is unloaded or finalized, so caches built from the
+         * loaded definitions (like the tile lookups in cata_tiles) can tell they are stale.
+         */
+        int data_generation() const {
+            return generation;
+        }
+
         /**
          * Get a possibly cached stream for deferred data loading. If the cached
          * stream is still in use by outside code, this returns a new stream to
@@ -1070,6 +1070,14 @@ diag_value const *item::maybe_get_value( std::string_view name ) const
     return global_variables::_common_maybe_get_value( std::string( name ), item_vars );
 }
 
+diag_value const *item::maybe_get_value( const std::string &name, uint32_t slot ) const
+{
+    if( item_vars.empty() ) {
+        return nullptr;
+    }
+    return global_variables::_common_maybe_get_value( name, slot, item_vars );
+}
+
 bool item::has_var( std::string_view name ) const
 {
     return !item_vars.empty() && item_vars.count( std::string( name ) ) > 0;
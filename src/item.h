@@ -2084,6 +2084,7 @@ class item : public visitable
         void remove_var( const std::string &key );
         diag_value const &get_value( std::string_view name ) const;
         diag_value const *maybe_get_value( std::string_view name ) const;
+        diag_value const *maybe_get_value( const std::string &name, uint32_t slot ) const;
         /** Whether the variable is defined at all. */
         bool has_var( std::string_view name ) const;
         /** Erase the value of the given variable. */
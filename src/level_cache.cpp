@@ -59,12 +59,14 @@ std::pair<vehicle *, int> level_cache::get_veh_cached_parts( const tripoint_bub_
 void level_cache::set_veh_exists_at( const tripoint_bub_ms &pt, bool exists_at )
 {
     veh_cache_cleared = false;
+    minimap_cache.reset( pt.x() + pt.y() * MAPSIZE_Y );
     veh_exists_at[ pt.x() * MAPSIZE_X + pt.y()] = exists_at;
 }
 
 void level_cache::set_veh_cached_parts( const tripoint_bub_ms &pt, vehicle &veh, int part_num )
 {
     veh_cache_cleared = false;
+    minimap_cache.reset( pt.x() + pt.y() * MAPSIZE_Y );
     veh_cached_parts[ pt ] = std::make_pair( &veh, part_num );
 }
 
@@ -73,6 +75,10 @@ void level_cache::clear_vehicle_cache()
     if( veh_cache_cleared ) {
         return;
     }
+    // Tiles vehicles left have to be recolored by the minimap.
+    for( const auto &part : veh_cached_parts ) {
+        minimap_cache.reset( part.first.x() + part.first.y() * MAPSIZE_Y );
+    }
     veh_exists_at.reset();
     veh_cached_parts.clear();
     veh_cache_cleared = true;
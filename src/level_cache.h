@@ -72,6 +72,9 @@ struct level_cache_default_zero_members {
     cata::mdarray<lit_level, point_bub_ms> visibility_cache;
     std::bitset<MAPSIZE_X *MAPSIZE_Y> map_memory_cache_dec;
     std::bitset<MAPSIZE_X *MAPSIZE_Y> map_memory_cache_ter;
+    // Set where the pixel minimap's color of the tile is up to date. Terrain,
+    // furniture, vehicle and visibility changes reset the bit.
+    std::bitset<MAPSIZE_X *MAPSIZE_Y> minimap_cache;
     std::bitset<MAPSIZE *MAPSIZE> field_cache;
 };
 // The only way to memset the above without UB is if it is trivially copyable
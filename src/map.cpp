@@ -315,12 +315,14 @@ map_stack::iterator map_stack::erase( map_stack::const_iterator it )
 
 void map_stack::insert( map &, const item &newitem )
 {
-    myorigin->add_item_or_charges( location, newitem );
+    insert( newitem );
 }
 
 void map_stack::insert( const item &newitem )
 {
     myorigin->add_item_or_charges( location, newitem );
+    // This may have been the placeholder for a tile without items, see map::i_at.
+    items = myorigin->i_at( location ).items;
 }
 
 units::volume map_stack::max_volume() const
@@ -474,6 +476,9 @@ void map::memory_cache_dec_set_dirty( const tripoint_bub_ms &p, bool value ) con
         return;
     }
     get_cache( p.z() ).map_memory_cache_dec[p.x() + p.y() * MAPSIZE_Y] = !value;
+    if( value ) {
+        minimap_cache_set_dirty( p, true );
+    }
 }
 
 bool map::memory_cache_ter_is_dirty( const tripoint_bub_ms &p ) const
@@ -492,6 +497,27 @@ void map::memory_cache_ter_set_dirty( const tripoint_bub_ms &p, bool value ) con
         return;
     }
     get_cache( p.z() ).map_memory_cache_ter[p.x() + p.y() * MAPSIZE_Y] = !value;
+    if( value ) {
+        minimap_cache_set_dirty( p, true );
+    }
+}
+
+bool map::minimap_cache_is_dirty( const tripoint_bub_ms &p ) const
+{
+    if( !inbounds( p ) ) {
+        debugmsg( "minimap_cache_is_dirty called on out of bounds position" );
+        return true;
+    }
+    return !get_cache( p.z() ).minimap_cache[p.x() + p.y() * MAPSIZE_Y];
+}
+
+void map::minimap_cache_set_dirty( const tripoint_bub_ms &p, bool value ) const
+{
+    if( !inbounds( p ) ) {
+        debugmsg( "minimap_cache_set_dirty called on out of bounds position" );
+        return;
+    }
+    get_cache( p.z() ).minimap_cache[p.x() + p.y() * MAPSIZE_Y] = !value;
 }
 
 void map::memory_clear_vehicle_points( const vehicle &veh ) const
@@ -3937,6 +3963,9 @@ void map::decay_fields_and_scent( const time_duration &amount )
                 }
 
                 for( int sy = 0; sy < SEEY; ++sy ) {
+                    if( !cur_submap->has_field_tile( { sx, sy } ) ) {
+                        continue;
+                    }
                     const point p( sx + smx * SEEX, sy + smy * SEEY );
 
                     const field &fields = cur_submap->get_field( { sx, sy} );
@@ -5576,6 +5605,12 @@ map_stack map::i_at( const tripoint_bub_ms &p )
         nulitems.clear();
         return map_stack{ &nulitems, p, this};
     }
+    // Looking at a submap without items must not allocate its item layer. Items are only
+    // ever added through the map, which does.
+    if( !current_submap->has_item_layer() ) {
+        nulitems.clear();
+        return map_stack{ &nulitems, p, this};
+    }
 
     return map_stack{ &current_submap->get_items( l ), p, this};
 }
@@ -5620,7 +5655,9 @@ void map::i_clear( const tripoint_bub_ms &p )
         set_lightmap_cache_dirty( p.z() );
     }
     current_submap->set_lum( l, 0 );
-    current_submap->get_items( l ).reset();
+    if( current_submap->has_item_layer() ) {
+        current_submap->get_items( l ).reset();
+    }
 }
 
 std::vector<item *> map::spawn_items( const tripoint_bub_ms &p, const std::vector<item> &new_items )
@@ -6399,6 +6436,9 @@ void map::process_items()
         // TODO: fix point types
         process_items_in_submap( *current_submap, local_pos );
         if( current_submap->active_items.empty() ) {
+            // The last active items may have rotted away or burnt out and taken the
+            // rest of the submap's items with them.
+            current_submap->release_empty_layers();
             iter = submaps_with_active_items.erase( iter );
         } else {
             ++iter;
@@ -7143,6 +7183,12 @@ field &map::field_at( const tripoint_bub_ms &p )
         nulfield = field();
         return nulfield;
     }
+    // Looking at a submap without fields must not allocate its field layer. Fields are only
+    // ever added through map::add_field, which does.
+    if( !current_submap->has_field_layer() ) {
+        nulfield = field();
+        return nulfield;
+    }
 
     return current_submap->get_field( l );
 }
@@ -7339,6 +7385,7 @@ bool map::add_field( const tripoint_bub_ms &p, const field_type_id &type_id, int
     invalidate_max_populated_zlev( p.z() );
 
     if( current_submap->get_field( l ).add_field( converted_type_id, intensity, age, source ) ) {
+        current_submap->set_field_tile( l, true );
         //Only adding it to the count if it doesn't exist.
         if( !current_submap->field_count++ ) {
             get_cache( p.z() ).field_cache.set(
@@ -7366,7 +7413,8 @@ void map::remove_field( const tripoint_bub_ms &p, const field_type_id &field_to_
 
 void map::delete_field( const tripoint_bub_ms &p, const field_type_id &field_to_remove )
 {
-    submap *current_submap = this->unsafe_get_submap_at( p );
+    point_sm_ms l;
+    submap *current_submap = this->unsafe_get_submap_at( p, l );
     field &curfield = this->get_field( p );
 
     // when displayed_field_type == fd_null it means that `curfield` has no fields inside
@@ -7379,6 +7427,9 @@ void map::delete_field( const tripoint_bub_ms &p, const field_type_id &field_to_
         if( it->second.get_field_type() == field_to_remove ) {
             --current_submap->field_count;
             curfield.remove_field( it );
+            if( curfield.field_count() == 0 ) {
+                current_submap->set_field_tile( l, false );
+            }
             set_lightmap_cache_dirty( p.z() );
             set_transparency_cache_dirty( p, true );
             break;
@@ -7557,7 +7608,8 @@ void map::update_visibility_cache( const int zlev )
 
     cata::mdarray<int, point_bub_sm> sm_squares_seen = {};
 
-    auto &visibility_cache = get_cache( zlev ).visibility_cache;
+    level_cache &ch = get_cache( zlev );
+    auto &visibility_cache = ch.visibility_cache;
 
     tripoint_bub_ms p;
     p.z() = zlev;
@@ -7566,7 +7618,10 @@ void map::update_visibility_cache( const int zlev )
     for( x = 0; x < MAPSIZE_X; x++ ) {
         for( y = 0; y < MAPSIZE_Y; y++ ) {
             lit_level ll = apparent_light_at( p, visibility_variables_cache );
-            visibility_cache[x][y] = ll;
+            if( visibility_cache[x][y] != ll ) {
+                visibility_cache[x][y] = ll;
+                ch.minimap_cache.reset( x + y * MAPSIZE_Y );
+            }
             sm_squares_seen[ x / SEEX ][ y / SEEY ] += ( ll == lit_level::BRIGHT || ll == lit_level::LIT );
         }
     }
@@ -8139,17 +8194,15 @@ bool map::sees( const tripoint_bub_ms &F, const tripoint_bub_ms &T, const int ra
         bresenham_slope = 0;
         return false; // Out of range!
     }
-    const point key = sees_cache_key( F, T );
-    if( allow_cached ) {
-        char cached = skew_cache.get( key, -1 );
-        if( cached != -1 ) {
-            return cached > 0;
-        }
-    }
     bool visible = true;
 
     // Ugly `if` for now
     if( F.z() == T.z() ) {
+        sight_field &field = sight_field_at( F, with_fields );
+        const size_t idx = sight_field::index( T.xy() );
+        if( allow_cached && field.known[idx] ) {
+            return field.visible[idx];
+        }
         bresenham( F.xy(), T.xy(), bresenham_slope,
         [this, f_transparent, &visible, &T]( const point_bub_ms & new_point ) {
             // Exit before checking the last square, it's still visible even if opaque.
@@ -8162,10 +8215,18 @@ bool map::sees( const tripoint_bub_ms &F, const tripoint_bub_ms &T, const int ra
             }
             return true;
         } );
-        skew_cache.insert( 100000, key, visible ? 1 : 0 );
+        field.known[idx] = true;
+        field.visible[idx] = visible;
         return visible;
     }
 
+    const point key = sees_cache_key( F, T );
+    if( allow_cached ) {
+        char cached = skew_cache.get( key, -1 );
+        if( cached != -1 ) {
+            return cached > 0;
+        }
+    }
     tripoint_bub_ms last_point = F;
     bresenham( F, T, bresenham_slope, 0,
     [this, f_transparent, &visible, &T, &last_point]( const tripoint_bub_ms & new_point ) {
@@ -8199,6 +8260,65 @@ bool map::sees( const tripoint_bub_ms &F, const tripoint_bub_ms &T, const int ra
     return visible;
 }
 
+map::sight_field &map::sight_field_at( const tripoint_bub_ms &from, bool with_fields ) const
+{
+    return ( with_fields ? sight_fields : sight_fields_wo_fields ).get( from );
+}
+
+void map::invalidate_sight_fields( const int zlev ) const
+{
+    sight_fields.drop_zlev( zlev );
+    sight_fields_wo_fields.drop_zlev( zlev );
+}
+
+const map::sight_field *map::sight_field_cache::find( const tripoint_bub_ms &from ) const
+{
+    const auto found = by_observer.find( from );
+    return found == by_observer.end() ? nullptr : &found->second->second;
+}
+
+map::sight_field &map::sight_field_cache::get( const tripoint_bub_ms &from )
+{
+    const auto found = by_observer.find( from );
+    if( found != by_observer.end() ) {
+        fields.splice( fields.end(), fields, found->second );
+        return found->second->second;
+    }
+    if( fields.size() >= limit ) {
+        by_observer.erase( fields.front().first );
+        spare.splice( spare.end(), fields, fields.begin() );
+    }
+    if( spare.empty() ) {
+        fields.emplace_back();
+    } else {
+        fields.splice( fields.end(), spare, spare.begin() );
+    }
+    entry &field = fields.back();
+    field.first = from;
+    field.second.known.reset();
+    field.second.visible.reset();
+    by_observer.emplace( from, std::prev( fields.end() ) );
+    return field.second;
+}
+
+void map::sight_field_cache::drop_zlev( const int zlev )
+{
+    for( auto it = fields.begin(); it != fields.end(); ) {
+        const auto next = std::next( it );
+        if( it->first.z() == zlev ) {
+            by_observer.erase( it->first );
+            spare.splice( spare.end(), fields, it );
+        }
+        it = next;
+    }
+}
+
+void map::sight_field_cache::clear()
+{
+    spare.splice( spare.end(), fields );
+    by_observer.clear();
+}
+
 int map::obstacle_coverage( const tripoint_bub_ms &loc1, const tripoint_bub_ms &loc2 ) const
 {
     // Can't hide if you are standing on furniture, or non-flat slowing-down terrain tile.
@@ -8731,7 +8851,7 @@ void map::reconcile_item_wakeups()
             for( int gridz = zmin; gridz <= zmax; gridz++ ) {
                 const tripoint_rel_sm grid( gridx, gridy, gridz );
                 submap *const sm = get_submap_at_grid( grid );
-                if( sm == nullptr ) {
+                if( sm == nullptr || !sm->has_item_layer() ) {
                     continue;
                 }
                 for( int sx = 0; sx < SEEX; ++sx ) {
@@ -8912,6 +9032,9 @@ void map::shift( const point_rel_sm &sp )
     // sx and sy should never be bigger than +/-1.
     // absx and absy are our position in the world, for saving/loading purposes.
     clear_vehicle_level_caches();
+    // Keyed by bubble positions, which all move.
+    sight_fields.clear();
+    sight_fields_wo_fields.clear();
 
     for( int gridz = zmin; gridz <= zmax; gridz++ ) {
         // Clear vehicle list and rebuild after shift
@@ -8922,6 +9045,7 @@ void map::shift( const point_rel_sm &sp )
         if( cache ) {
             shift_bitset_cache<MAPSIZE_X, SEEX>( cache->map_memory_cache_dec, sp );
             shift_bitset_cache<MAPSIZE_X, SEEX>( cache->map_memory_cache_ter, sp );
+            shift_bitset_cache<MAPSIZE_X, SEEX>( cache->minimap_cache, sp );
             shift_bitset_cache<MAPSIZE, 1>( cache->field_cache, sp );
         }
     }
@@ -9022,6 +9146,9 @@ void map::saven( const tripoint_bub_sm &grid )
     dbg( D_INFO ) << "map::saven abs: " << abs
                   << "  gridn: " << gridn;
     submap_to_save->last_touched = calendar::turn;
+    // Empty item and field layers hold nothing that could still be referenced.
+    submap_to_save->release_empty_layers();
+    submap_to_save->share_identical_layers();
     MAPBUFFER.add_submap( abs, submap_to_save );
 }
 
@@ -9090,6 +9217,10 @@ void map::loadn( const point_bub_sm &grid, bool update_vehicles )
         }
     }
 
+    // TODO: Generate unvisited OMTs near the player's path ahead of time on the background
+    // workers. mapgen draws from the global RNG and writes straight into overmap_buffer,
+    // MAPBUFFER, the item and monster factories and the vehicle caches, so it first needs a
+    // detached target whose side effects are applied here, on the main thread.
     if( map_incomplete ) {
         smallmap tmp_map;
         swap_map swap( *tmp_map.cast_to_map() );
@@ -10596,6 +10727,9 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     bool camera_cache_dirty = false;
     for( int z = minz; z <= maxz; z++ ) {
         build_outside_cache( z );
+        if( get_cache( z ).transparency_cache_dirty.any() ) {
+            invalidate_sight_fields( z );
+        }
         build_transparency_cache( z );
         bool floor_cache_was_dirty = build_floor_cache( z );
         seen_cache_dirty |= floor_cache_was_dirty;
@@ -10613,6 +10747,8 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     if( seen_cache_dirty ) {
         skew_vision_cache.clear();
         skew_vision_wo_fields_cache.clear();
+        sight_fields.clear();
+        sight_fields_wo_fields.clear();
     }
     avatar &u = get_avatar();
     Character::moncam_cache_t mcache = u.get_active_moncams();
@@ -11260,8 +11396,7 @@ void map::function_over( const tripoint_bub_ms &start, const tripoint_bub_ms &en
     }
 }
 
-void map::scent_blockers( std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &blocks_scent,
-                          std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &reduces_scent,
+void map::scent_blockers( std::array<std::array<int, MAPSIZE_Y>, MAPSIZE_X> &scent_weight,
                           const point_bub_ms &min, const point_bub_ms &max )
 {
     ter_furn_flag reduce = ter_furn_flag::TFLAG_REDUCE_SCENT;
@@ -11270,15 +11405,12 @@ void map::scent_blockers( std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &bl
         // We need to generate the x/y coordinates, because we can't get them "for free"
         const point_sm_ms p = lp + coords::project_to<coords::ms>( gp.xy() );
         if( sm->get_ter( lp ).obj().has_flag( block ) ) {
-            blocks_scent[p.x()][p.y()] = true;
-            reduces_scent[p.x()][p.y()] = false;
+            scent_weight[p.x()][p.y()] = scent_map::weight_blocked;
         } else if( sm->get_ter( lp ).obj().has_flag( reduce ) ||
                    sm->get_furn( lp ).obj().has_flag( reduce ) ) {
-            blocks_scent[p.x()][p.y()] = false;
-            reduces_scent[p.x()][p.y()] = true;
+            scent_weight[p.x()][p.y()] = scent_map::weight_reduced;
         } else {
-            blocks_scent[p.x()][p.y()] = false;
-            reduces_scent[p.x()][p.y()] = false;
+            scent_weight[p.x()][p.y()] = scent_map::weight_open;
         }
 
         return ITER_CONTINUE;
@@ -11301,7 +11433,8 @@ void map::scent_blockers( std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &bl
             }
             const tripoint_bub_ms part_pos = vp.pos_bub( *this );
             if( local_bounds.contains( part_pos.xy() ) ) {
-                reduces_scent[part_pos.x()][part_pos.y()] = true;
+                int &weight = scent_weight[part_pos.x()][part_pos.y()];
+                weight = std::min( weight, scent_map::weight_reduced );
             }
         }
     }
@@ -11743,6 +11876,18 @@ void map::invalidate_max_populated_zlev( int zlev )
 
 bool map::has_potential_los( const tripoint_bub_ms &from, const tripoint_bub_ms &to ) const
 {
+    if( from.z() == to.z() ) {
+        for( const std::pair<tripoint_bub_ms, tripoint_bub_ms> &seen : {
+                 std::make_pair( from, to ), std::make_pair( to, from )
+             } ) {
+            const sight_field *const field = sight_fields.find( seen.first );
+            const size_t idx = sight_field::index( seen.second.xy() );
+            if( field != nullptr && inbounds( seen.second ) && field->known[idx] ) {
+                return field->visible[idx];
+            }
+        }
+        return true;
+    }
     const point key = sees_cache_key( from, to );
     char cached = skew_vision_cache.get( key, -1 );
     if( cached != -1 ) {
@@ -511,6 +511,10 @@ class map
         void memory_cache_dec_set_dirty( const tripoint_bub_ms &p, bool value ) const;
         // sets whether map memory terrain should be re/memorized
         void memory_cache_ter_set_dirty( const tripoint_bub_ms &p, bool value ) const;
+        // @returns true if the pixel minimap has to recolor the tile
+        bool minimap_cache_is_dirty( const tripoint_bub_ms &p ) const;
+        // sets whether the pixel minimap has to recolor the tile
+        void minimap_cache_set_dirty( const tripoint_bub_ms &p, bool value ) const;
         // clears map memory for points occupied by vehicle and marks "dirty" for re-memorizing
         void memory_clear_vehicle_points( const vehicle &veh ) const;
 
@@ -632,8 +636,55 @@ class map
                          const oter_id &om_ter );
         void create_hot_air( const tripoint_bub_ms &p, int intensity );
         bool gas_can_spread_to( field_entry &cur, const maptile &dst );
-        void gas_spread_to( field_entry &cur, maptile &dst, const tripoint_bub_ms &p );
+        void gas_spread_to( field_entry &cur, const tripoint_bub_ms &src,
+                            const tripoint_bub_ms &dst );
         int burn_body_part( Character &you, field_entry &cur, const bodypart_id &bp, int scale );
+
+        /**
+         * A change that processing the fields of one tile makes to the fields of
+         * another. process_fields queues these and applies them after every submap
+         * has been processed: each tile reads its neighbours as they were when the
+         * step began and writes into the next step, so the outcome does not depend
+         * on the order tiles are visited in.
+         */
+        struct field_spread {
+            enum class kind : int {
+                // Add intensity and age to the field, creating it if missing. If it
+                // cannot be created they are given back to the tile at refund_to.
+                merge,
+                // Create the field only if the tile does not have a live one.
+                create,
+                // Add intensity (never past cap) and age to an existing live field.
+                boost,
+                // Kill the field.
+                clear
+            };
+            kind op = kind::merge;
+            tripoint_bub_ms dst;
+            field_type_id type;
+            int intensity = 0;
+            time_duration age = 0_turns;
+            int cap = INT_MAX;
+            bool hit_player = true;
+            effect_source source;
+            std::optional<tripoint_bub_ms> refund_to;
+            // Charged to the field of the same type at `at` only if the op takes effect.
+            struct cost {
+                tripoint_bub_ms at;
+                field_type_id type;
+                int intensity = 0;
+                time_duration age = 0_turns;
+            };
+            std::optional<cost> paid_by;
+            // Field on dst that is killed only if the op takes effect.
+            field_type_id consumes;
+        };
+        std::vector<field_spread> field_spreads;
+        // Queues a spread and returns it so the caller can fill in the optional members.
+        field_spread &queue_field_spread( field_spread::kind op, const tripoint_bub_ms &dst,
+                                          const field_type_id &type, int intensity,
+                                          const time_duration &age = 0_turns );
+        void apply_field_spreads();
     public:
 
         // Movement and LOS
@@ -730,6 +781,12 @@ class map
         bool sees( const tripoint_bub_ms &F, const tripoint_bub_ms &T, int range, int &bresenham_slope,
                    bool with_fields = true, bool allow_cached = true ) const;
         point sees_cache_key( const tripoint_bub_ms &from, const tripoint_bub_ms &to ) const;
+        struct sight_field;
+        // Returns the memoized sees() results of an observer at `from` for targets on its
+        // z-level, creating an empty field if there is none.
+        sight_field &sight_field_at( const tripoint_bub_ms &from, bool with_fields ) const;
+        // Drops the sight fields of observers on zlev, after its transparency cache changed.
+        void invalidate_sight_fields( int zlev ) const;
     public:
         /**
         * Returns coverage of target in relation to the observer. Target is loc2, observer is loc1.
@@ -1360,6 +1417,8 @@ class map
         // the list in map.  Used in tests.
         void check_submap_active_item_consistency();
         // Accessor that returns a wrapped reference to an item stack for safe modification.
+        // While the submap holds no items at all, this is an empty placeholder that does not
+        // see items added through other means than the stack itself; get it again after that.
         map_stack i_at( const tripoint_bub_ms &p );
         map_stack i_at( const point_bub_ms &p ) {
             return i_at( tripoint_bub_ms( p, abs_sub.z() ) );
@@ -1599,6 +1658,8 @@ class map
         const field &field_at( const tripoint_bub_ms &p ) const;
         /**
          * Gets fields that are here. Both for querying and edition.
+         * While the submap holds no fields at all, this is an empty placeholder; add fields
+         * through @ref add_field and get it again afterwards.
          */
         field &field_at( const tripoint_bub_ms &p );
         /**
@@ -1730,11 +1791,10 @@ class map
 
         // Scent propagation helpers
         /**
-         * Build the map of scent-resistant tiles.
+         * Build the map of scent-resistant tiles, as the scent_map weight of each tile.
          * Should be way faster than if done in `game.cpp` using public map functions.
          */
-        void scent_blockers( std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &blocks_scent,
-                             std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &reduces_scent,
+        void scent_blockers( std::array<std::array<int, MAPSIZE_Y>, MAPSIZE_X> &scent_weight,
                              const point_bub_ms &min, const point_bub_ms &max );
 
         // Computers
@@ -2307,6 +2367,49 @@ class map
         mutable lru_cache_t skew_vision_cache;
         mutable lru_cache_t skew_vision_wo_fields_cache;
 
+        /**
+         * Visibility of every tile on an observer's z-level, as seen by bresenham from the
+         * observer's tile. Filled in as sees() is asked about each target, so a monster
+         * checking the same tiles every turn does each bresenham walk once until the
+         * transparency cache of its z-level is rebuilt.
+         */
+        struct sight_field {
+            std::bitset<MAPSIZE_X *MAPSIZE_Y> known;
+            std::bitset<MAPSIZE_X *MAPSIZE_Y> visible;
+
+            static constexpr size_t index( const point_bub_ms &p ) {
+                return static_cast<size_t>( p.x() ) * MAPSIZE_Y + p.y();
+            }
+        };
+        /**
+         * Sight fields by observer tile. Past the limit, the least recently used field is
+         * dropped, and its storage is reused for the next observer.
+         */
+        class sight_field_cache
+        {
+            public:
+                // The field of an observer at `from`, or nullptr if there is none. Does not
+                // count as a use.
+                const sight_field *find( const tripoint_bub_ms &from ) const;
+                // The field of an observer at `from`, creating an empty one if needed.
+                sight_field &get( const tripoint_bub_ms &from );
+                // Drops the fields of observers on zlev.
+                void drop_zlev( int zlev );
+                void clear();
+
+            private:
+                using entry = std::pair<tripoint_bub_ms, sight_field>;
+                // Enough for every creature of a busy reality bubble.
+                static constexpr size_t limit = 512;
+                // From the least to the most recently used.
+                std::list<entry> fields;
+                // Storage of dropped fields, waiting to be reused.
+                std::list<entry> spare;
+                std::map<tripoint_bub_ms, std::list<entry>::iterator> by_observer;
+        };
+        mutable sight_field_cache sight_fields;
+        mutable sight_field_cache sight_fields_wo_fields;
+
         // Note: no bounds check
         level_cache &get_cache( int zlev ) const {
             std::unique_ptr<level_cache, level_cache_free> &cache = caches[zlev + OVERMAP_DEPTH];
@@ -18,6 +18,7 @@
 #include "avatar.h"
 #include "bodypart.h"
 #include "calendar.h"
+#include "cata_thread_pool.h"
 #include "cata_utility.h"
 #include "character.h"
 #include "coordinates.h"
@@ -162,8 +163,64 @@ int map::burn_body_part( Character &you, field_entry &cur, const bodypart_id &bp
     return total_damage;
 }
 
+// Below this many submaps with fields, handing the snapshot to other threads
+// costs more than it saves.
+static constexpr size_t min_parallel_field_submaps = 16;
+
+// Snapshot the fields of a submap as the state the step starts from.
+static void begin_field_step( submap &sm )
+{
+    if( sm.field_tile_count() == 0 ) {
+        return;
+    }
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            if( !sm.has_field_tile( { x, y } ) ) {
+                continue;
+            }
+            field &curfield = sm.get_field( { x, y } );
+            for( std::pair<const field_type_id, field_entry> &fd : curfield ) {
+                fd.second.begin_step();
+            }
+        }
+    }
+}
+
+// The field of the given type on `tile` as it was when the step began, or nullptr.
+static const field_entry *step_field( const maptile &tile, const field_type_id &type )
+{
+    const field_entry *entry = tile.get_field().find_field( type, false );
+    return entry != nullptr && entry->get_step_intensity() > 0 ? entry : nullptr;
+}
+
 void map::process_fields()
 {
+    // Read-previous: neighbours are read from this snapshot while tiles are
+    // processed. Write-next: changes to other tiles queue in field_spreads.
+    std::vector<submap *> field_submaps;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        const auto &field_cache = get_cache( z ).field_cache;
+        for( int x = 0; x < my_MAPSIZE; x++ ) {
+            for( int y = 0; y < my_MAPSIZE; y++ ) {
+                if( field_cache[ x + y * MAPSIZE ] ) {
+                    if( submap *const sm = get_submap_at_grid( tripoint_rel_sm{ x, y, z } ) ) {
+                        field_submaps.push_back( sm );
+                    }
+                }
+            }
+        }
+    }
+    // Taking the snapshot only touches each submap's own fields, so with enough
+    // of them it is split over the background workers.
+    if( field_submaps.size() >= min_parallel_field_submaps ) {
+        cata::background_workers().parallel_for( field_submaps.size(), [&field_submaps]( size_t i ) {
+            begin_field_step( *field_submaps[i] );
+        } );
+    } else {
+        for( submap *const sm : field_submaps ) {
+            begin_field_step( *sm );
+        }
+    }
     for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
         auto &field_cache = get_cache( z ).field_cache;
         for( int x = 0; x < my_MAPSIZE; x++ ) {
@@ -177,11 +234,103 @@ void map::process_fields()
                     process_fields_in_submap( current_submap, { x, y, z } );
                     if( current_submap->field_count == 0 ) {
                         field_cache[ x + y * MAPSIZE ] = false;
+                        current_submap->release_empty_layers();
+                    }
+                }
+            }
+        }
+    }
+    apply_field_spreads();
+}
+
+map::field_spread &map::queue_field_spread( field_spread::kind op, const tripoint_bub_ms &dst,
+        const field_type_id &type, int intensity, const time_duration &age )
+{
+    field_spread &spread = field_spreads.emplace_back();
+    spread.op = op;
+    spread.dst = dst;
+    spread.type = type;
+    spread.intensity = intensity;
+    spread.age = age;
+    return spread;
+}
+
+void map::apply_field_spreads()
+{
+    for( const field_spread &spread : field_spreads ) {
+        // Out of bounds, get_field finds nothing and add_field fails, so gas
+        // spreading off the map is refunded like gas that cannot be merged.
+        field_entry *target = get_field( spread.dst, spread.type );
+        bool applied = false;
+        switch( spread.op ) {
+            case field_spread::kind::merge:
+                if( target != nullptr ) {
+                    target->set_field_intensity( target->get_field_intensity() + spread.intensity );
+                    target->mod_field_age( spread.age );
+                    on_field_modified( spread.dst, *spread.type );
+                    applied = true;
+                } else if( add_field( spread.dst, spread.type, spread.intensity, 0_turns,
+                                      spread.hit_player, spread.source ) ) {
+                    target = get_field( spread.dst, spread.type );
+                    if( target != nullptr ) {
+                        target->set_field_age( spread.age );
                     }
+                    applied = true;
+                } else if( spread.refund_to ) {
+                    // The source may have spread its last intensity away and died
+                    // meanwhile; the gas still goes back to its tile.
+                    if( field_entry *src = get_field( *spread.refund_to, spread.type ) ) {
+                        src->set_field_intensity( src->get_field_intensity() + spread.intensity );
+                        src->mod_field_age( spread.age );
+                    } else if( add_field( *spread.refund_to, spread.type, spread.intensity, 0_turns,
+                                          spread.hit_player, spread.source ) ) {
+                        if( field_entry *revived = get_field( *spread.refund_to, spread.type ) ) {
+                            revived->set_field_age( spread.age );
+                        }
+                    }
+                }
+                break;
+            case field_spread::kind::create:
+                if( target == nullptr ) {
+                    applied = add_field( spread.dst, spread.type, spread.intensity, spread.age,
+                                         spread.hit_player, spread.source );
                 }
+                break;
+            case field_spread::kind::boost:
+                if( target != nullptr ) {
+                    const int intensity = target->get_field_intensity();
+                    if( intensity < spread.cap ) {
+                        target->set_field_intensity( std::min( spread.cap,
+                                                               intensity + spread.intensity ) );
+                    }
+                    target->mod_field_age( spread.age );
+                    applied = true;
+                }
+                break;
+            case field_spread::kind::clear:
+                if( target != nullptr ) {
+                    target->set_field_intensity( 0 );
+                    applied = true;
+                }
+                break;
+        }
+        if( !applied ) {
+            continue;
+        }
+        if( spread.paid_by ) {
+            field_entry *payer = get_field( spread.paid_by->at, spread.paid_by->type );
+            if( payer != nullptr ) {
+                payer->mod_field_age( spread.paid_by->age );
+                payer->mod_field_intensity( -spread.paid_by->intensity );
+            }
+        }
+        if( spread.consumes ) {
+            if( field_entry *consumed = get_field( spread.dst, spread.consumes ) ) {
+                consumed->set_field_intensity( 0 );
             }
         }
     }
+    field_spreads.clear();
 }
 
 bool ter_furn_has_flag( const ter_t &ter, const furn_t &furn, const ter_furn_flag flag )
@@ -237,9 +386,9 @@ std::array<std::pair<tripoint_bub_ms, maptile>, 8> map::get_neighbors( const tri
 
 bool map::gas_can_spread_to( field_entry &cur, const maptile &dst )
 {
-    const field_entry *tmpfld = dst.get_field().find_field( cur.get_field_type() );
+    const field_entry *tmpfld = step_field( dst, cur.get_field_type() );
     // Candidates are existing weaker fields or navigable/flagged tiles with no field.
-    if( tmpfld == nullptr || tmpfld->get_field_intensity() < cur.get_field_intensity() ) {
+    if( tmpfld == nullptr || tmpfld->get_step_intensity() < cur.get_field_intensity() ) {
         const ter_t &ter = dst.get_ter_t();
         const furn_t &frn = dst.get_furn_t();
         return ter_furn_movecost( ter, frn ) > 0 ||
@@ -248,30 +397,18 @@ bool map::gas_can_spread_to( field_entry &cur, const maptile &dst )
     return false;
 }
 
-void map::gas_spread_to( field_entry &cur, maptile &dst, const tripoint_bub_ms &p )
+void map::gas_spread_to( field_entry &cur, const tripoint_bub_ms &src,
+                         const tripoint_bub_ms &dst )
 {
-    const field_type_id current_type = cur.get_field_type();
     const time_duration current_age = cur.get_field_age();
     const int current_intensity = cur.get_field_intensity();
-    field_entry *f = dst.find_field( current_type );
-    // Nearby gas grows thicker, and ages are shared.
+    // Nearby gas grows thicker, and ages are shared. A new field is created if
+    // there is none; if that fails, the gas returns to `src`.
     const time_duration age_fraction = current_age / current_intensity;
-    if( f != nullptr ) {
-        f->set_field_intensity( f->get_field_intensity() + 1 );
-        cur.set_field_intensity( current_intensity - 1 );
-        f->set_field_age( f->get_field_age() + age_fraction );
-        cur.set_field_age( current_age - age_fraction );
-        // Or, just create a new field.
-    } else if( add_field( p, current_type, 1, 0_turns ) ) {
-        f = dst.find_field( current_type );
-        if( f != nullptr ) {
-            f->set_field_age( age_fraction );
-        } else {
-            debugmsg( "While spreading the gas, field was added but doesn't exist." );
-        }
-        cur.set_field_intensity( current_intensity - 1 );
-        cur.set_field_age( current_age - age_fraction );
-    }
+    queue_field_spread( field_spread::kind::merge, dst, cur.get_field_type(), 1,
+                        age_fraction ).refund_to = src;
+    cur.set_field_intensity( current_intensity - 1 );
+    cur.set_field_age( current_age - age_fraction );
 }
 
 void map::spread_gas( field_entry &cur, const tripoint_bub_ms &p, int percent_spread,
@@ -314,7 +451,7 @@ void map::spread_gas( field_entry &cur, const tripoint_bub_ms &p, int percent_sp
         const tripoint_bub_ms down = p + tripoint_rel_ms::below;
         maptile down_tile = maptile_at_internal( down );
         if( gas_can_spread_to( cur, down_tile ) && valid_move( p, down, true, true ) ) {
-            gas_spread_to( cur, down_tile, down );
+            gas_spread_to( cur, p, down );
             return;
         }
     }
@@ -338,8 +475,8 @@ void map::spread_gas( field_entry &cur, const tripoint_bub_ms &p, int percent_sp
     if( !spread.empty() && one_in( spread.size() ) ) {
         // Construct the destination from offset and p
         if( sheltered || windpower < 5 ) {
-            std::pair<tripoint_bub_ms, maptile> &n = neighs[ random_entry( spread ) ];
-            gas_spread_to( cur, n.second, n.first );
+            const std::pair<tripoint_bub_ms, maptile> &n = neighs[ random_entry( spread ) ];
+            gas_spread_to( cur, p, n.first );
         } else {
             std::vector<size_t> neighbour_vec;
             auto maptiles = get_wind_blockers( winddirection, p );
@@ -357,15 +494,16 @@ void map::spread_gas( field_entry &cur, const tripoint_bub_ms &p, int percent_sp
                 }
             }
             if( !neighbour_vec.empty() ) {
-                std::pair<tripoint_bub_ms, maptile> &n = neighs[ random_entry( neighbour_vec ) ];
-                gas_spread_to( cur, n.second, n.first );
+                const std::pair<tripoint_bub_ms, maptile> &n =
+                    neighs[ random_entry( neighbour_vec ) ];
+                gas_spread_to( cur, p, n.first );
             }
         }
     } else if( p.z() < OVERMAP_HEIGHT ) {
         const tripoint_bub_ms up = p + tripoint_rel_ms::above;
         maptile up_tile = maptile_at_internal( up );
         if( gas_can_spread_to( cur, up_tile ) && valid_move( p, up, true, true ) ) {
-            gas_spread_to( cur, up_tile, up );
+            gas_spread_to( cur, p, up );
         }
     }
 }
@@ -413,8 +551,8 @@ void map::create_hot_air( const tripoint_bub_ms &p, int intensity )
     }
 
     for( int counter = 0; counter < 5; counter++ ) {
-        tripoint_bub_ms dst( p + point( rng( -1, 1 ), rng( -1, 1 ) ) );
-        add_field( dst, hot_air, 1 );
+        const tripoint_bub_ms dst( p + point( rng( -1, 1 ), rng( -1, 1 ) ) );
+        queue_field_spread( field_spread::kind::merge, dst, hot_air, 1 );
     }
 }
 
@@ -462,16 +600,22 @@ void map::process_fields_in_submap( submap *const current_submap,
         &( *fd_null )
     };
 
-    // Loop through all tiles in this submap indicated by current_submap
+    // Loop through the tiles of current_submap that hold fields. The set is read
+    // live, so a field added to a later tile while processing is still visited,
+    // as it was when every tile was scanned.
     for( locx = 0; locx < SEEX; locx++ ) {
         for( locy = 0; locy < SEEY; locy++ ) {
+            if( !current_submap->has_field_tile( map_tile.pos() ) ) {
+                continue;
+            }
             // Get a reference to the field variable from the submap;
             // contains all the pointers to the real field effects.
-            field &curfield = current_submap->get_field( { static_cast<int>( locx ), static_cast<int>( locy ) } );
+            field &curfield = current_submap->get_field( map_tile.pos() );
 
             // when displayed_field_type == fd_null it means that `curfield` has no fields inside
             // avoids instantiating (relatively) expensive map iterator
             if( !curfield.displayed_field_type() ) {
+                current_submap->set_field_tile( map_tile.pos(), false );
                 continue;
             }
 
@@ -514,6 +658,9 @@ void map::process_fields_in_submap( submap *const current_submap,
                 }
                 ++it;
             }
+            if( curfield.field_count() == 0 ) {
+                current_submap->set_field_tile( map_tile.pos(), false );
+            }
         }
     }
     sblk.commit_modifications();
@@ -927,12 +1074,12 @@ void field_processor_fd_incendiary( const tripoint_bub_ms &p, field_entry &cur,
     if( pd.here.has_flag( ter_furn_flag::TFLAG_FLAMMABLE, dst ) ||
         pd.here.has_flag( ter_furn_flag::TFLAG_FLAMMABLE_ASH, dst ) ||
         pd.here.has_flag( ter_furn_flag::TFLAG_FLAMMABLE_HARD, dst ) ) {
-        pd.here.add_field( dst, fd_fire, 1 );
+        pd.here.queue_field_spread( map::field_spread::kind::merge, dst, fd_fire, 1 );
     }
 
     // Check piles for flammable items and set those on fire
     if( pd.here.flammable_items_at( dst ) ) {
-        pd.here.add_field( dst, fd_fire, 1 );
+        pd.here.queue_field_spread( map::field_spread::kind::merge, dst, fd_fire, 1 );
     }
 
     pd.here.create_hot_air( p, cur.get_field_intensity() );
@@ -1115,26 +1262,29 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
             tripoint_bub_ms dst = p + tripoint::below;
             if( here.valid_move( p, dst, true, true ) ) {
                 maptile dst_tile = here.maptile_at_internal( dst );
-                field_entry *fire_there = dst_tile.find_field( fd_fire );
+                const field_entry *fire_there = step_field( dst_tile, fd_fire );
                 if( !fire_there ) {
-                    here.add_field( dst, fd_fire, 1, 0_turns, true, cur.get_effect_source() );
-                    cur.mod_field_intensity( -1 );
+                    // The fire only leaves this tile if it lands below.
+                    map::field_spread &fall =
+                        here.queue_field_spread( map::field_spread::kind::create, dst, fd_fire, 1 );
+                    fall.source = cur.get_effect_source();
+                    fall.paid_by = { p, fd_fire, 1 };
                 } else {
+                    const int intensity_there = fire_there->get_step_intensity();
                     // Don't fuel raging fires or they'll burn forever
                     // as they can produce small fires above themselves
-                    int new_intensity = std::max( cur.get_field_intensity(),
-                                                  fire_there->get_field_intensity() );
+                    int new_intensity = std::max( cur.get_field_intensity(), intensity_there );
                     // Allow smaller fires to combine
-                    if( new_intensity < 3 &&
-                        cur.get_field_intensity() == fire_there->get_field_intensity() ) {
+                    if( new_intensity < 3 && cur.get_field_intensity() == intensity_there ) {
                         new_intensity++;
                     }
                     // A raging fire below us can support us for a while
                     // Otherwise decay and decay fast
-                    if( fire_there->get_field_intensity() < 3 || one_in( 10 ) ) {
+                    if( intensity_there < 3 || one_in( 10 ) ) {
                         cur.set_field_intensity( cur.get_field_intensity() - 1 );
                     }
-                    fire_there->set_field_intensity( new_intensity );
+                    here.queue_field_spread( map::field_spread::kind::boost, dst, fd_fire,
+                                             new_intensity - intensity_there ).cap = new_intensity;
                 }
                 return;
             }
@@ -1186,26 +1336,28 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
             // if there is more fire there, make it bigger and give it some fuel.
             // This is how big fires spend their excess age:
             // making other fires bigger. Flashpoint.
+            // Age promised to queued boosts, charged only for those that land.
+            time_duration pledged = 0_turns;
             if( sheltered || windpower < 5 ) {
                 end_it = static_cast<size_t>( rng( 0, neighs.size() - 1 ) );
                 for( size_t i = ( end_it + 1 ) % neighs.size(), count = 0;
-                     count != neighs.size() && cur.get_field_age() < 0_turns;
+                     count != neighs.size() && cur.get_field_age() + pledged < 0_turns;
                      i = ( i + 1 ) % neighs.size(), count++ ) {
                     maptile &dst = neighs[i].second;
-                    field_entry *dstfld = dst.find_field( fd_fire );
+                    const field_entry *dstfld = step_field( dst, fd_fire );
                     // If the fire exists and is weaker than ours, boost it
                     if( dstfld &&
-                        ( dstfld->get_field_intensity() <= cur.get_field_intensity() ||
-                          dstfld->get_field_age() > cur.get_field_age() ) &&
+                        ( dstfld->get_step_intensity() <= cur.get_field_intensity() ||
+                          dstfld->get_step_age() > cur.get_field_age() ) &&
                         ( in_pit == ( dst.get_ter() == ter_t_pit ) ) ) {
-                        if( dstfld->get_field_intensity() < 2 ) {
-                            // HACK: ignoring all map field caches, since field already exists
-                            // and intensity is increased, not decreased
-                            dstfld->mod_field_intensity( 1 );
-                        }
-
-                        dstfld->mod_field_age( -5_minutes );
-                        cur.set_field_age( cur.get_field_age() + 5_minutes );
+                        map::field_spread &boost =
+                            here.queue_field_spread( map::field_spread::kind::boost,
+                                                     neighs[i].first, fd_fire,
+                                                     dstfld->get_step_intensity() < 2 ? 1 : 0,
+                                                     -5_minutes );
+                        boost.cap = 2;
+                        boost.paid_by = { p, fd_fire, 0, 5_minutes };
+                        pledged += 5_minutes;
                     }
                     if( dstfld ) {
                         adjacent_fires++;
@@ -1214,23 +1366,23 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
             } else {
                 end_it = static_cast<size_t>( rng( 0, neighbour_vec.size() - 1 ) );
                 for( size_t i = ( end_it + 1 ) % neighbour_vec.size(), count = 0;
-                     count != neighbour_vec.size() && cur.get_field_age() < 0_turns;
+                     count != neighbour_vec.size() && cur.get_field_age() + pledged < 0_turns;
                      i = ( i + 1 ) % neighbour_vec.size(), count++ ) {
                     maptile &dst = neighs[neighbour_vec[i]].second;
-                    field_entry *dstfld = dst.find_field( fd_fire );
+                    const field_entry *dstfld = step_field( dst, fd_fire );
                     // If the fire exists and is weaker than ours, boost it
                     if( dstfld &&
-                        ( dstfld->get_field_intensity() <= cur.get_field_intensity() ||
-                          dstfld->get_field_age() > cur.get_field_age() ) &&
+                        ( dstfld->get_step_intensity() <= cur.get_field_intensity() ||
+                          dstfld->get_step_age() > cur.get_field_age() ) &&
                         ( in_pit == ( dst.get_ter() == ter_t_pit ) ) ) {
-                        if( dstfld->get_field_intensity() < 2 ) {
-                            // HACK: ignoring all map field caches, since field already exists
-                            // and intensity is increased, not decreased
-                            dstfld->mod_field_intensity( 1 );
-                        }
-
-                        dstfld->set_field_age( dstfld->get_field_age() - 5_minutes );
-                        cur.set_field_age( cur.get_field_age() + 5_minutes );
+                        map::field_spread &boost =
+                            here.queue_field_spread( map::field_spread::kind::boost,
+                                                     neighs[neighbour_vec[i]].first, fd_fire,
+                                                     dstfld->get_step_intensity() < 2 ? 1 : 0,
+                                                     -5_minutes );
+                        boost.cap = 2;
+                        boost.paid_by = { p, fd_fire, 0, 5_minutes };
+                        pledged += 5_minutes;
                     }
 
                     if( dstfld ) {
@@ -1255,7 +1407,7 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
                 maximum_intensity = 3;
             } else {
                 for( auto &neigh : neighs ) {
-                    if( neigh.second.get_field().find_field( fd_fire ) ) {
+                    if( step_field( neigh.second, fd_fire ) ) {
                         adjacent_fires++;
                     }
                 }
@@ -1288,11 +1440,12 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
             dst_ter.has_flag( ter_furn_flag::TFLAG_FLAMMABLE ) ||
             dst_ter.has_flag( ter_furn_flag::TFLAG_FLAMMABLE_ASH ) ||
             dst_ter.has_flag( ter_furn_flag::TFLAG_FLAMMABLE_HARD ) ) {
-            field_entry *nearfire = dst.find_field( fd_fire );
-            if( nearfire != nullptr ) {
-                nearfire->mod_field_age( -2_turns );
+            if( step_field( dst, fd_fire ) != nullptr ) {
+                here.queue_field_spread( map::field_spread::kind::boost, dst_p, fd_fire, 0,
+                                         -2_turns );
             } else {
-                here.add_field( dst_p, fd_fire, 1, 0_turns, true, cur.get_effect_source() );
+                here.queue_field_spread( map::field_spread::kind::create, dst_p, fd_fire,
+                                         1 ).source = cur.get_effect_source();
             }
             // Fueling fires above doesn't cost fuel
         }
@@ -1316,12 +1469,12 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
             // This will create small oddities on map edges, but nothing more noticeable than
             // "cut-off" that happens with bounds checks.
 
-            if( dst.find_field( fd_fire ) ) {
+            if( step_field( dst, fd_fire ) ) {
                 // We handled supporting fires in the section above, no need to do it here
                 continue;
             }
 
-            field_entry *nearwebfld = dst.find_field( fd_web );
+            const field_entry *nearwebfld = step_field( dst, fd_web );
             int spread_chance = 25 * ( cur.get_field_intensity() - 1 );
             if( nearwebfld ) {
                 spread_chance = 50 + spread_chance / 2;
@@ -1346,12 +1499,14 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
                 ) ) {
                 // Nearby open flammable ground? Set it on fire.
                 // Make the new fire quite weak, so that it doesn't start jumping around instantly
-                if( here.add_field( dst_p, fd_fire, 1, 2_minutes, true, cur.get_effect_source() ) ) {
-                    // Consume a bit of our fuel
-                    cur.set_field_age( cur.get_field_age() + 1_minutes );
-                }
+                map::field_spread &ignite =
+                    here.queue_field_spread( map::field_spread::kind::create, dst_p, fd_fire, 1,
+                                             2_minutes );
+                ignite.source = cur.get_effect_source();
+                // Consume a bit of our fuel, and the web, if the fire catches
+                ignite.paid_by = { p, fd_fire, 0, 1_minutes };
                 if( nearwebfld ) {
-                    nearwebfld->set_field_intensity( 0 );
+                    ignite.consumes = fd_web;
                 }
             }
         }
@@ -1376,12 +1531,12 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
             // This will create small oddities on map edges, but nothing more noticeable than
             // "cut-off" that happens with bounds checks.
 
-            if( dst.find_field( fd_fire ) ) {
+            if( step_field( dst, fd_fire ) ) {
                 // We handled supporting fires in the section above, no need to do it here
                 continue;
             }
 
-            field_entry *nearwebfld = dst.find_field( fd_web );
+            const field_entry *nearwebfld = step_field( dst, fd_web );
             int spread_chance = 25 * ( cur.get_field_intensity() - 1 );
             if( nearwebfld ) {
                 spread_chance = 50 + spread_chance / 2;
@@ -1406,12 +1561,14 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
                 ) ) {
                 // Nearby open flammable ground? Set it on fire.
                 // Make the new fire quite weak, so that it doesn't start jumping around instantly
-                if( here.add_field( dst_p, fd_fire, 1, 2_minutes, true, cur.get_effect_source() ) ) {
-                    // Consume a bit of our fuel
-                    cur.set_field_age( cur.get_field_age() + 1_minutes );
-                }
+                map::field_spread &ignite =
+                    here.queue_field_spread( map::field_spread::kind::create, dst_p, fd_fire, 1,
+                                             2_minutes );
+                ignite.source = cur.get_effect_source();
+                // Consume a bit of our fuel, and the web, if the fire catches
+                ignite.paid_by = { p, fd_fire, 0, 1_minutes };
                 if( nearwebfld ) {
-                    nearwebfld->set_field_intensity( 0 );
+                    ignite.consumes = fd_web;
                 }
             }
         }
@@ -1424,7 +1581,8 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
         if( smoke_up ) {
             tripoint_bub_ms up{p + tripoint::above};
             if( here.has_flag_ter( ter_furn_flag::TFLAG_NO_FLOOR, up ) ) {
-                here.add_field( up, fd_smoke, rng( 1, cur.get_field_intensity() ), 0_turns, false );
+                here.queue_field_spread( map::field_spread::kind::merge, up, fd_smoke,
+                                         rng( 1, cur.get_field_intensity() ) ).hit_player = false;
             } else {
                 // Can't create smoke above
                 smoke_up = false;
@@ -1839,6 +1997,13 @@ void map::maybe_apply_field_effect( const std::vector<field_effect> &vfe, Creatu
 
 void map::creature_in_field( Creature &critter )
 {
+    const tripoint_bub_ms pos = critter.pos_bub();
+    point_sm_ms l;
+    const submap *const current_submap = inbounds( pos ) ? unsafe_get_submap_at( pos, l ) : nullptr;
+    if( current_submap == nullptr || !current_submap->has_field_tile( l ) ) {
+        // Nothing here to step in.
+        return;
+    }
     if( critter.is_monster() ) {
         monster_in_field( *static_cast<monster *>( &critter ) );
     } else {
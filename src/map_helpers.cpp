@@ -102,8 +102,8 @@ void clear_fields( const int zlevel )
 
             submap *sm = here.get_submap_at( p, offset );
             if( sm ) {
+                sm->clear_fields( offset );
                 sm->field_count = 0;
-                sm->get_field( offset ).clear();
             }
         }
     }
@@ -1,12 +1,16 @@
 #include <algorithm>
 #include <cstddef>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <ostream>
+#include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include "cached_options.h"
@@ -65,6 +69,15 @@ struct reg_coord_pair {
 };
 } // namespace
 
+int mm_palette::index_of( uint32_t id )
+{
+    const auto [it, inserted] = indexes.emplace( id, static_cast<int>( ids.size() ) );
+    if( inserted ) {
+        ids.push_back( id );
+    }
+    return it->second;
+}
+
 mm_submap::mm_submap( bool make_valid ) : valid( make_valid ) {}
 
 bool mm_submap::is_empty() const
@@ -110,24 +123,72 @@ bool mm_region::is_empty() const
     return true;
 }
 
+namespace
+{
+// Map memory is only read and written on the main thread, so the pool is not locked.
+struct memorized_id_pool {
+    // deque so references handed out by get_ter_id() stay valid as the pool grows
+    std::deque<std::string> ids = { std::string() };
+    // Keys point into ids, so looking up an id that is already pooled does not allocate.
+    std::unordered_map<std::string_view, uint32_t> indexes = { { ids.front(), 0 } };
+};
+
+memorized_id_pool &id_pool()
+{
+    static memorized_id_pool pool;
+    return pool;
+}
+
+// Number of map_memory objects alive; the pool may only be emptied when the one left is.
+int live_map_memories = 0;
+} // namespace
+
+uint32_t memorized_tile::intern_id( std::string_view id )
+{
+    if( id.empty() ) {
+        return 0;
+    }
+    memorized_id_pool &pool = id_pool();
+    const auto it = pool.indexes.find( id );
+    if( it != pool.indexes.end() ) {
+        return it->second;
+    }
+    const uint32_t index = static_cast<uint32_t>( pool.ids.size() );
+    pool.indexes.emplace( pool.ids.emplace_back( id ), index );
+    return index;
+}
+
+void memorized_tile::clear_id_pool()
+{
+    memorized_id_pool &pool = id_pool();
+    pool.indexes.clear();
+    pool.ids.resize( 1 );
+    pool.indexes.emplace( pool.ids.front(), 0 );
+}
+
+const std::string &memorized_tile::pooled_id( uint32_t index )
+{
+    return id_pool().ids[index];
+}
+
 const std::string &memorized_tile::get_ter_id() const
 {
-    return ter_id.str();
+    return pooled_id( ter_id );
 }
 
 const std::string &memorized_tile::get_dec_id() const
 {
-    return dec_id;
+    return pooled_id( dec_id );
 }
 
 void memorized_tile::set_ter_id( std::string_view id )
 {
-    ter_id = ter_str_id( id );
+    ter_id = intern_id( id );
 }
 
 void memorized_tile::set_dec_id( std::string_view id )
 {
-    dec_id = id;
+    dec_id = intern_id( id );
 }
 
 int memorized_tile::get_ter_rotation() const
@@ -208,9 +269,15 @@ map_memory::coord_pair::coord_pair( const tripoint_abs_ms &p )
 
 map_memory::map_memory()
 {
+    live_map_memories++;
     clear_cache();
 }
 
+map_memory::~map_memory()
+{
+    live_map_memories--;
+}
+
 const memorized_tile &map_memory::get_tile( const tripoint_abs_ms &pos ) const
 {
     const coord_pair p( pos );
@@ -561,6 +628,11 @@ void map_memory::clear()
 {
     clear_cache();
     submaps.clear();
+    // With no other map memory around, nothing refers to the pooled ids any more, and
+    // the ones from a previous world or mod set would otherwise stay for good.
+    if( live_map_memories == 1 ) {
+        memorized_tile::clear_id_pool();
+    }
     dbg( D_INFO ) << "[CLEAR] Done.";
 }
 void map_memory::clear_cache()
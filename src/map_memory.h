@@ -6,6 +6,7 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "coordinates.h"
@@ -45,14 +46,44 @@ class memorized_tile
         }
     private:
         friend struct mm_submap; // serialization needs access to private members
-        ter_str_id ter_id;       // terrain tile id
-        std::string dec_id;      // decoration tile id (furniture, vparts ...)
+        friend struct mm_region;
+        friend class map_memory;
+
+        /**
+         * Tile ids are dictionary encoded: every distinct id string is stored
+         * once in a process-wide pool and tiles refer to it by index. Index 0
+         * is the empty id. Pooled strings are not moved, and are only freed by
+         * clear_id_pool once no tiles refer to them.
+         */
+        static uint32_t intern_id( std::string_view id );
+        static const std::string &pooled_id( uint32_t index );
+        static void clear_id_pool();
+
+        uint32_t ter_id = 0;     // terrain tile id, index into the id pool
+        uint32_t dec_id = 0;     // decoration tile id (furniture, vparts ...), same
         int8_t ter_rotation = 0;
         int8_t dec_rotation = 0;
         int8_t ter_subtile = 0;
         int8_t dec_subtile = 0;
 };
 
+/**
+ * Region-local dictionary of the tile ids used in one saved region, so each
+ * id string is written once per region file and tiles refer to it by index.
+ */
+struct mm_palette {
+    // Saving: pooled id -> region-local index.
+    std::unordered_map<uint32_t, int> indexes;
+    // Saving: region-local index -> pooled id, written out as the palette.
+    std::vector<uint32_t> ids;
+    // Loading: region-local index -> pooled terrain id, after terrain migration.
+    std::vector<uint32_t> ter_ids;
+    // Loading: region-local index -> pooled decoration id.
+    std::vector<uint32_t> dec_ids;
+
+    int index_of( uint32_t id );
+};
+
 /** Represent a submap-sized chunk of tile memory. */
 struct mm_submap {
     public:
@@ -69,8 +100,16 @@ struct mm_submap {
         const memorized_tile &get_tile( const point_sm_ms &p ) const;
         void set_tile( const point_sm_ms &p, const memorized_tile &value );
 
-        void serialize( JsonOut &jsout ) const;
-        void deserialize( int version, const JsonArray &ja );
+        /**
+         * @param palette region-local indexes of the pooled ids already written,
+         * extended with the ids this submap adds.
+         */
+        void serialize( JsonOut &jsout, mm_palette &palette ) const;
+        /**
+         * @param palette pooled ids of the region-local terrain and decoration
+         * indexes, only used since version 2.
+         */
+        void deserialize( int version, const JsonArray &ja, const mm_palette &palette );
 
     private:
         // NOLINTNEXTLINE(cata-serialize)
@@ -114,6 +153,9 @@ class map_memory
 
     public:
         map_memory();
+        map_memory( const map_memory & ) = delete;
+        map_memory &operator=( const map_memory & ) = delete;
+        ~map_memory();
 
         // @returns true if map memory has been loaded
         bool is_valid() const;
@@ -444,6 +444,7 @@ void mapbuffer::deserialize( const JsonArray &ja )
                 sm->load( submap_member, submap_member_name, version );
             }
         }
+        sm->share_identical_layers();
 
         if( !add_submap( submap_coordinates, sm ) ) {
             debugmsg( "submap %s was already loaded", submap_coordinates.to_string() );
@@ -1354,6 +1354,10 @@ class mapgen_value
             virtual const std::string *get_name_if_parameter() const {
                 return nullptr;
             }
+            // Whether get() may return different values for the same parameters
+            virtual bool is_random() const {
+                return false;
+            }
         };
 
         struct null_source : value_source {
@@ -1499,6 +1503,10 @@ class mapgen_value
                 return *list.pick();
             }
 
+            bool is_random() const override {
+                return true;
+            }
+
             void check( const std::string &context, const mapgen_parameters & ) const override {
                 for( const std::pair<StringId, int> &wo : list ) {
                     if( !is_valid_helper( wo.first ) ) {
@@ -1555,6 +1563,10 @@ class mapgen_value
                 return Id( it->second );
             }
 
+            bool is_random() const override {
+                return on->is_random();
+            }
+
             void check( const std::string &context, const mapgen_parameters &params
                       ) const override {
                 on->check( context, params );
@@ -1662,6 +1674,10 @@ class mapgen_value
             return is_null_;
         }
 
+        bool is_random() const {
+            return source_->is_random();
+        }
+
         void check( const std::string &context, const mapgen_parameters &params ) const {
             source_->check( context, params );
         }
@@ -2952,11 +2968,17 @@ class jmapgen_furniture : public jmapgen_piece_with_has_vehicle_collision
  */
 class jmapgen_terrain : public jmapgen_piece_with_has_vehicle_collision
 {
-    private:
+    public:
         enum apply_action {
             act_unknown, act_ignore, act_dismantle, act_erase
         };
-    public:
+        /** What to do with whatever already occupies a tile before placing terrain on it. */
+        struct placement_rules {
+            apply_action furn = apply_action::act_unknown;
+            apply_action trap = apply_action::act_unknown;
+            apply_action item = apply_action::act_unknown;
+        };
+
         mapgen_value<ter_str_id> id;
         jmapgen_terrain( const JsonObject &jsi, std::string_view/*context*/ ) :
             jmapgen_terrain( jsi.get_member( "ter" ) ) {}
@@ -2975,68 +2997,77 @@ class jmapgen_terrain : public jmapgen_piece_with_has_vehicle_collision
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            tripoint_bub_ms p( x.get(), y.get(), dat.zlevel() + z.get() );
-
-            const ter_id &terrain_here = dat.m.ter( p );
-            const ter_t &chosen_ter = *chosen_id;
-            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
-            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
-            const bool is_boring_wall = is_wall && !place_item;
+            const tripoint_bub_ms p( x.get(), y.get(), dat.zlevel() + z.get() );
+            place( dat, p, chosen_id, rules_for( dat, context ), context );
+        }
 
-            apply_action act_furn = apply_action::act_unknown;
-            apply_action act_trap = apply_action::act_unknown;
-            apply_action act_item = apply_action::act_unknown;
+        // The rules only depend on the mapgen flags, so callers placing many tiles at once
+        // can compute them a single time.
+        static placement_rules rules_for( const mapgendata &dat, const std::string &context ) {
+            placement_rules rules;
 
             // shorthand flags
             // Keep in sync with flags_clear_furniture() used by the static overlap check
             if( dat.has_flag( jmapgen_flags::allow_terrain_under_other_data ) ) {
-                act_furn = apply_action::act_ignore;
-                act_trap = apply_action::act_ignore;
-                act_item = apply_action::act_ignore;
+                rules.furn = apply_action::act_ignore;
+                rules.trap = apply_action::act_ignore;
+                rules.item = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::dismantle_all_before_placing_terrain ) ) {
-                act_furn = apply_action::act_dismantle;
-                act_trap = apply_action::act_dismantle;
-                act_item = apply_action::act_ignore;
+                rules.furn = apply_action::act_dismantle;
+                rules.trap = apply_action::act_dismantle;
+                rules.item = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::erase_all_before_placing_terrain ) ) {
-                act_furn = apply_action::act_erase;
-                act_trap = apply_action::act_erase;
-                act_item = apply_action::act_erase;
+                rules.furn = apply_action::act_erase;
+                rules.trap = apply_action::act_erase;
+                rules.item = apply_action::act_erase;
             }
 
             // specific flags override shorthand flags
             if( dat.has_flag( jmapgen_flags::allow_terrain_under_furniture ) ) {
-                act_furn = apply_action::act_ignore;
+                rules.furn = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::dismantle_furniture_before_placing_terrain ) ) {
-                act_furn = apply_action::act_dismantle;
+                rules.furn = apply_action::act_dismantle;
             } else if( dat.has_flag( jmapgen_flags::erase_furniture_before_placing_terrain ) ) {
-                act_furn = apply_action::act_erase;
+                rules.furn = apply_action::act_erase;
             }
             if( dat.has_flag( jmapgen_flags::allow_terrain_under_trap ) ) {
-                act_trap = apply_action::act_ignore;
+                rules.trap = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::dismantle_trap_before_placing_terrain ) ) {
-                act_trap = apply_action::act_dismantle;
+                rules.trap = apply_action::act_dismantle;
             } else if( dat.has_flag( jmapgen_flags::erase_trap_before_placing_terrain ) ) {
-                act_trap = apply_action::act_erase;
+                rules.trap = apply_action::act_erase;
             }
             if( dat.has_flag( jmapgen_flags::allow_terrain_under_items ) ) {
-                act_item = apply_action::act_ignore;
+                rules.item = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::erase_items_before_placing_terrain ) ) {
-                act_item = apply_action::act_erase;
+                rules.item = apply_action::act_erase;
             }
 
-            if( act_item == apply_action::act_erase &&
-                ( act_furn == apply_action::act_dismantle || act_trap == apply_action::act_dismantle ) ) {
+            if( rules.item == apply_action::act_erase &&
+                ( rules.furn == apply_action::act_dismantle ||
+                  rules.trap == apply_action::act_dismantle ) ) {
                 debugmsg( "In %s on %s, the mapgen is configured to dismantle preexisting furniture "
                           "and/or traps, but will also erase preexisting items.  This is probably a "
                           "mistake, as any dismantle outputs will not be preserved.",
                           context, dat.terrain_type().id().str() );
             }
 
-            if( is_boring_wall || act_furn == apply_action::act_erase ) {
+            return rules;
+        }
+
+        static void place( const mapgendata &dat, const tripoint_bub_ms &p, const ter_id &chosen_id,
+                           const placement_rules &rules, const std::string &context ) {
+            const ter_id &terrain_here = dat.m.ter( p );
+            const ter_t &chosen_ter = *chosen_id;
+            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
+            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
+            const bool is_boring_wall = is_wall && !place_item;
+
+            if( is_boring_wall || rules.furn == apply_action::act_erase ) {
                 dat.m.furn_clear( p );
                 // remove sign writing data from the submap
                 dat.m.delete_signage( p );
-            } else if( act_furn == apply_action::act_dismantle ) {
+            } else if( rules.furn == apply_action::act_dismantle ) {
                 int max_recurse = 10; // insurance against infinite looping
                 std::string initial_furn = dat.m.furn( p ) != furn_str_id::NULL_ID() ? dat.m.furn(
                                                p ).id().str() : "";
@@ -3073,27 +3104,28 @@ class jmapgen_terrain : public jmapgen_piece_with_has_vehicle_collision
                 dat.m.delete_signage( p );
             }
 
-            if( is_boring_wall || act_trap == apply_action::act_erase ) {
+            if( is_boring_wall || rules.trap == apply_action::act_erase ) {
                 dat.m.remove_trap( p );
-            } else if( act_trap == apply_action::act_dismantle ) {
+            } else if( rules.trap == apply_action::act_dismantle ) {
                 dat.m.tr_at( p ).on_disarmed( dat.m, p );
             }
 
-            if( is_boring_wall || act_item == apply_action::act_erase ) {
+            if( is_boring_wall || rules.item == apply_action::act_erase ) {
                 dat.m.i_clear( p );
             }
 
             if( chosen_id != terrain_here ) {
                 std::string error;
                 trap_str_id trap_here = dat.m.tr_at( p ).id;
-                if( act_furn != apply_action::act_ignore && dat.m.furn( p ) != furn_str_id::NULL_ID() ) {
+                if( rules.furn != apply_action::act_ignore &&
+                    dat.m.furn( p ) != furn_str_id::NULL_ID() ) {
                     // NOLINTNEXTLINE(cata-translate-string-literal)
                     error = string_format( "furniture was %s", dat.m.furn( p ).id().str() );
-                } else if( act_trap != apply_action::act_ignore && !trap_here.is_null() &&
+                } else if( rules.trap != apply_action::act_ignore && !trap_here.is_null() &&
                            trap_here.id() != terrain_here->trap ) {
                     // NOLINTNEXTLINE(cata-translate-string-literal)
                     error = string_format( "trap %s existed", trap_here.str() );
-                } else if( act_item != apply_action::act_ignore && !dat.m.i_at( p ).empty() ) {
+                } else if( rules.item != apply_action::act_ignore && !dat.m.i_at( p ).empty() ) {
                     // NOLINTNEXTLINE(cata-translate-string-literal)
                     error = string_format( "item %s existed",
                                            dat.m.i_at( p ).begin()->typeId().str() );
@@ -4967,6 +4999,41 @@ void jmapgen_objects::finalize()
 {
     std::stable_sort( objects.begin(), objects.end(), compare_phases );
     objects.shrink_to_fit();
+    compile_terrain_plan();
+}
+
+bool jmapgen_objects::use_terrain_plan = true;
+
+void jmapgen_objects::compile_terrain_plan()
+{
+    terrain_plan.clear();
+    terrain_slots.clear();
+
+    const auto is_fixed = []( const jmapgen_int & v ) {
+        return v.val == v.valmax;
+    };
+    std::unordered_map<const jmapgen_piece *, int> slot_of;
+    auto range = std::equal_range( objects.begin(), objects.end(), mapgen_phase::terrain,
+                                   compare_phases );
+    for( auto it = range.first; it != range.second; ++it ) {
+        const jmapgen_place &where = it->first;
+        const jmapgen_piece &what = *it->second;
+        compiled_terrain_step step{ tripoint_rel_ms( where.x.val, where.y.val, where.z.val ), -1,
+                                    static_cast<size_t>( it - objects.begin() ) };
+        const jmapgen_terrain *ter = dynamic_cast<const jmapgen_terrain *>( &what );
+        if( ter && is_fixed( where.x ) && is_fixed( where.y ) && is_fixed( where.z ) &&
+            is_fixed( where.repeat ) && is_fixed( what.repeat ) &&
+            std::max( where.repeat.val, what.repeat.val ) == 1 ) {
+            auto slot = slot_of.emplace( &what, static_cast<int>( terrain_slots.size() ) );
+            if( slot.second ) {
+                terrain_slots.push_back( &what );
+            }
+            step.slot = slot.first->second;
+        }
+        terrain_plan.push_back( step );
+    }
+    terrain_plan.shrink_to_fit();
+    terrain_slots.shrink_to_fit();
 }
 
 void jmapgen_objects::check( const std::string &context, const mapgen_parameters &parameters ) const
@@ -6404,6 +6471,11 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
                              const tripoint_rel_ms &offset,
                              const std::string &context ) const
 {
+    if( phase == mapgen_phase::terrain && use_terrain_plan && !terrain_plan.empty() ) {
+        apply_terrain_plan( dat, offset, context );
+        return;
+    }
+
     bool terrain_resolved = false;
 
     auto range_at_phase = std::equal_range( objects.begin(), objects.end(), phase, compare_phases );
@@ -6434,6 +6506,48 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
     }
 }
 
+void jmapgen_objects::apply_terrain_plan( const mapgendata &dat, const tripoint_rel_ms &offset,
+        const std::string &context ) const
+{
+    // Parameters cannot change while this runs, so anything that is not a random
+    // distribution resolves to the same terrain on every tile it is used on.
+    std::vector<ter_id> resolved( terrain_slots.size() );
+    for( size_t i = 0; i < terrain_slots.size(); ++i ) {
+        const jmapgen_terrain &piece = static_cast<const jmapgen_terrain &>( *terrain_slots[i] );
+        if( !piece.id.is_random() ) {
+            resolved[i] = piece.id.get( dat ).id();
+        }
+    }
+
+    std::optional<jmapgen_terrain::placement_rules> rules;
+    for( const compiled_terrain_step &step : terrain_plan ) {
+        if( step.slot < 0 ) {
+            const jmapgen_obj &obj = objects[step.object];
+            jmapgen_place where = obj.first;
+            where.offset( tripoint_rel_ms( -offset.raw() ) );
+            const jmapgen_piece &what = *obj.second;
+            const int repeat = std::max( where.repeat.get(), what.repeat.get() );
+            for( int i = 0; i < repeat; i++ ) {
+                what.apply( dat, where.x, where.y, where.z, context );
+            }
+            continue;
+        }
+        const jmapgen_terrain &piece = static_cast<const jmapgen_terrain &>
+                                       ( *terrain_slots[step.slot] );
+        const ter_id chosen_id = piece.id.is_random() ? piece.id.get( dat ).id() :
+                                 resolved[step.slot];
+        if( chosen_id.id().is_null() ) {
+            continue;
+        }
+        if( !rules ) {
+            rules = jmapgen_terrain::rules_for( dat, context );
+        }
+        const tripoint_rel_ms p = step.p + offset;
+        jmapgen_terrain::place( dat, tripoint_bub_ms( p.x(), p.y(), dat.zlevel() + p.z() ),
+                                chosen_id, *rules, context );
+    }
+}
+
 ret_val<void> jmapgen_objects::has_vehicle_collision( const mapgendata &dat,
         const tripoint_rel_ms &offset ) const
 {
@@ -445,6 +445,33 @@ struct jmapgen_objects {
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+
+        /**
+         * The terrain phase lowered by finalize() into a flat list of steps.  Terrain placed
+         * on one fixed tile (which is what every terrain key in the rows becomes) is stored as
+         * the tile plus an index into terrain_slots, so that apply() can resolve each distinct
+         * terrain once per call instead of once per tile.  Everything else in the terrain
+         * phase is kept as a reference back into objects and applied as usual.
+         */
+        struct compiled_terrain_step {
+            tripoint_rel_ms p;
+            // Index into terrain_slots, or -1 to apply objects[object] instead.
+            int slot;
+            size_t object;
+        };
+        std::vector<compiled_terrain_step> terrain_plan;
+        // Always jmapgen_terrain pieces
+        std::vector<const jmapgen_piece *> terrain_slots;
+
+        // Whether apply() places terrain through terrain_plan. Only switched off by tests,
+        // to check the plan against applying each piece.
+        static bool use_terrain_plan;
+        // for testing
+        friend class terrain_plan_meddler;
+
+        void compile_terrain_plan();
+        void apply_terrain_plan( const mapgendata &dat, const tripoint_rel_ms &offset,
+                                 const std::string &context ) const;
         tripoint_rel_ms m_offset;
         point_rel_ms mapgensize;
         point_rel_ms total_size;
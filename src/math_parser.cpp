@@ -24,6 +24,7 @@
 #include "debug.h"
 #include "dialogue.h"
 #include "dialogue_helpers.h"
+#include "math_parser_bytecode.h"
 #include "math_parser_diag.h"
 #include "math_parser_diag_value.h"
 #include "math_parser_func.h"
@@ -270,7 +271,8 @@ func_jmath::func_jmath( std::vector<thingie> &&params_,
 
 double func::eval( const_dialogue const &d ) const
 {
-    return f( _eval_params( params, d ) );
+    std::vector<double> const elems = _eval_params( params, d );
+    return f( math_func_args( elems ) );
 }
 
 double func_jmath::eval( const_dialogue const &d ) const
@@ -460,7 +462,9 @@ class math_exp::math_exp_impl
 {
     public:
         math_exp_impl() = default;
-        explicit math_exp_impl( thingie &&t ): tree( t ) {}
+        explicit math_exp_impl( thingie &&t ): tree( t ) {
+            program.compile( tree );
+        }
 
         bool parse( std::string_view str, bool handle_errors ) {
             if( str.empty() ) {
@@ -475,19 +479,27 @@ class math_exp::math_exp_impl
                     output = {};
                     arity = {};
                     tree = thingie { 0.0 };
+                    program.compile( tree );
                     return false;
                 }
 
                 throw math::exception( error( str, ex.what() ) );
             }
+            program.compile( tree );
             return true;
         }
         double eval( const_dialogue const &d ) const {
-            return tree.eval( d );
+            return program.empty() ? tree.eval( d ) : program.eval( d );
         }
         double eval( dialogue &d ) const {
+            return program.empty() ? tree.eval( d ) : program.eval( d );
+        }
+        double eval_tree( const_dialogue const &d ) const {
             return tree.eval( d );
         }
+        bool compiled() const {
+            return !program.empty();
+        }
 
         math_type_t get_type() const {
             return type;
@@ -524,6 +536,7 @@ class math_exp::math_exp_impl
         };
         std::stack<arity_t> arity;
         thingie tree{ 0.0 };
+        math_program program;
         std::string_view parse_position;
         parse_state state;
         math_type_t type = math_type_t::ret;
@@ -1012,6 +1025,7 @@ void math_exp::math_exp_impl::new_var( std::string_view str )
         scoped = scoped.substr( 1 );
     }
     output.emplace( std::in_place_type_t<var>(), type, std::string{ scoped } );
+    std::get<var>( output.top().data ).varinfo.intern();
 }
 
 std::string math_exp::math_exp_impl::error( std::string_view str, std::string_view what )
@@ -1075,6 +1089,16 @@ double math_exp::eval( dialogue &d ) const
     return impl->eval( d );
 }
 
+double math_exp::eval_tree( const_dialogue const &d ) const
+{
+    return impl->eval_tree( d );
+}
+
+bool math_exp::compiled() const
+{
+    return impl->compiled();
+}
+
 math_type_t math_exp::get_type() const
 {
     return impl->get_type();
@@ -26,6 +26,10 @@ class math_exp
         bool parse( std::string_view str, bool handle_errors = true );
         double eval( dialogue &d ) const;
         double eval( const_dialogue const &d ) const;
+        // Evaluates the parsed tree, bypassing the compiled program. For tests and benchmarks.
+        double eval_tree( const_dialogue const &d ) const;
+        // Whether eval() runs the compiled program rather than walking the tree.
+        bool compiled() const;
 
         math_type_t get_type() const;
 
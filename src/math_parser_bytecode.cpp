@@ -0,0 +1,318 @@
+#include "math_parser_bytecode.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+#include "cata_utility.h"
+#include "dialogue.h"
+#include "math_parser_jmath.h"
+#include "math_parser_type.h"
+
+namespace
+{
+
+math_func const *find_math_func( math_func::f_t f )
+{
+    auto const it = std::find_if( functions.begin(), functions.end(),
+    [f]( math_func const & mf ) {
+        return mf.f == f;
+    } );
+    return it == functions.end() ? nullptr : &*it;
+}
+
+} // namespace
+
+bool math_program::compile( thingie const &tree )
+{
+    *this = math_program();
+    if( !compile_node( tree ) || max_depth > static_cast<int>( max_stack ) ||
+        vars.size() > max_vars ) {
+        *this = math_program();
+        return false;
+    }
+    return true;
+}
+
+void math_program::emit( instruction const &ins, int stack_change )
+{
+    code.push_back( ins );
+    depth += stack_change;
+    max_depth = std::max( max_depth, depth );
+}
+
+bool math_program::is_constant_from( std::size_t first ) const
+{
+    return code.size() == first + 1 && code[first].op == opcode::constant;
+}
+
+bool math_program::compile_node( thingie const &t )
+{
+    return std::visit( overloaded{
+        [this]( double v )
+        {
+            instruction ins;
+            ins.value = v;
+            emit( ins, 1 );
+            return true;
+        },
+        [this]( var const & v )
+        {
+            auto const it = std::find_if( vars.begin(), vars.end(), [&v]( var const & known ) {
+                return known.varinfo.type == v.varinfo.type && known.varinfo.name == v.varinfo.name;
+            } );
+            instruction ins;
+            ins.op = opcode::load;
+            ins.arg = static_cast<int>( it - vars.begin() );
+            if( it == vars.end() ) {
+                vars.push_back( v );
+            }
+            emit( ins, 1 );
+            return true;
+        },
+        [this]( oper const & v )
+        {
+            return compile_oper( v );
+        },
+        [this]( func const & v )
+        {
+            return compile_func( v );
+        },
+        [this]( func_jmath const & v )
+        {
+            return compile_jmath( v );
+        },
+        [this]( ternary const & v )
+        {
+            return compile_ternary( v );
+        },
+        [this]( ass_oper const & v )
+        {
+            return compile_assign( v );
+        },
+        [this, &t]( auto const & v )
+        {
+            if constexpr( v_has_eval<decltype( v )> ) {
+                instruction ins;
+                ins.op = opcode::node;
+                ins.arg = static_cast<int>( nodes.size() );
+                nodes.push_back( t );
+                emit( ins, 1 );
+                return true;
+            }
+            // Strings, arrays and kwargs only make sense as dialogue function arguments.
+            return false;
+        },
+    },
+    t.data );
+}
+
+bool math_program::compile_oper( oper const &o )
+{
+    std::size_t const first = code.size();
+    if( !compile_node( *o.l ) ) {
+        return false;
+    }
+    std::size_t const second = code.size();
+    bool const l_constant = is_constant_from( first );
+    if( !compile_node( *o.r ) ) {
+        return false;
+    }
+    if( l_constant && code.size() == second + 1 && code[second].op == opcode::constant ) {
+        double const folded = o.op( code[first].value, code[second].value );
+        code.resize( first );
+        depth -= 2;
+        instruction ins;
+        ins.value = folded;
+        emit( ins, 1 );
+        return true;
+    }
+    instruction ins;
+    ins.op = opcode::binary;
+    ins.bin = o.op;
+    emit( ins, -1 );
+    return true;
+}
+
+bool math_program::compile_func( func const &f )
+{
+    std::size_t const first = code.size();
+    bool all_constant = true;
+    for( thingie const &param : f.params ) {
+        std::size_t const param_first = code.size();
+        if( !compile_node( param ) ) {
+            return false;
+        }
+        all_constant = all_constant && is_constant_from( param_first );
+    }
+    int const nparams = static_cast<int>( f.params.size() );
+    math_func const *mf = find_math_func( f.f );
+    if( all_constant && mf != nullptr && mf->pure ) {
+        std::vector<double> args;
+        for( std::size_t i = first; i < code.size(); i++ ) {
+            args.push_back( code[i].value );
+        }
+        double const folded = f.f( math_func_args( args ) );
+        code.resize( first );
+        depth -= nparams;
+        instruction ins;
+        ins.value = folded;
+        emit( ins, 1 );
+        return true;
+    }
+    instruction ins;
+    ins.op = opcode::func;
+    ins.arg = nparams;
+    ins.fn = f.f;
+    emit( ins, 1 - nparams );
+    return true;
+}
+
+bool math_program::compile_jmath( func_jmath const &f )
+{
+    for( thingie const &param : f.params ) {
+        if( !compile_node( param ) ) {
+            return false;
+        }
+    }
+    int const nparams = static_cast<int>( f.params.size() );
+    instruction ins;
+    ins.op = opcode::jmath;
+    ins.arg = nparams;
+    ins.index = static_cast<int>( jmaths.size() );
+    jmaths.push_back( f.id );
+    emit( ins, 1 - nparams );
+    return true;
+}
+
+bool math_program::compile_ternary( ternary const &t )
+{
+    std::size_t const first = code.size();
+    if( !compile_node( *t.cond ) ) {
+        return false;
+    }
+    if( is_constant_from( first ) ) {
+        bool const cond = code[first].value > 0;
+        code.resize( first );
+        depth--;
+        return compile_node( cond ? *t.mhs : *t.rhs );
+    }
+
+    std::size_t const jump_to_rhs = code.size();
+    instruction branch;
+    branch.op = opcode::jump_unless;
+    emit( branch, -1 );
+    if( !compile_node( *t.mhs ) ) {
+        return false;
+    }
+    std::size_t const jump_to_end = code.size();
+    instruction skip;
+    skip.op = opcode::jump;
+    emit( skip, 0 );
+    // Only one of the branches runs, so the rhs starts from the same depth as the mhs.
+    depth--;
+    code[jump_to_rhs].arg = static_cast<int>( code.size() );
+    if( !compile_node( *t.rhs ) ) {
+        return false;
+    }
+    code[jump_to_end].arg = static_cast<int>( code.size() );
+    return true;
+}
+
+bool math_program::compile_assign( ass_oper const &a )
+{
+    if( !compile_node( *a.mhs ) || !compile_node( *a.rhs ) ) {
+        return false;
+    }
+    instruction ins;
+    ins.op = opcode::assign;
+    ins.arg = static_cast<int>( nodes.size() );
+    ins.bin = a.op;
+    nodes.push_back( *a.lhs );
+    emit( ins, -1 );
+    return true;
+}
+
+template<typename D>
+double math_program::run( D &d ) const
+{
+    std::array<double, max_stack> stack;
+    std::array<double, max_vars> slots;
+    std::uint64_t loaded = 0;
+    std::size_t sp = 0;
+    std::size_t pc = 0;
+    while( pc < code.size() ) {
+        instruction const &ins = code[pc++];
+        switch( ins.op ) {
+            case opcode::constant:
+                stack[sp++] = ins.value;
+                break;
+            case opcode::load: {
+                std::uint64_t const bit = std::uint64_t{ 1 } << ins.arg;
+                if( !( loaded & bit ) ) {
+                    slots[ins.arg] = vars[ins.arg].eval( d );
+                    loaded |= bit;
+                }
+                stack[sp++] = slots[ins.arg];
+                break;
+            }
+            case opcode::binary:
+                sp--;
+                stack[sp - 1] = ins.bin( stack[sp - 1], stack[sp] );
+                break;
+            case opcode::func:
+                sp -= static_cast<std::size_t>( ins.arg );
+                stack[sp] = ins.fn( math_func_args( &stack[sp], ins.arg ) );
+                sp++;
+                break;
+            case opcode::jmath:
+                sp -= static_cast<std::size_t>( ins.arg );
+                stack[sp] = jmaths[ins.index]->eval( d, std::vector<double>( &stack[sp],
+                                                     &stack[sp] + ins.arg ) );
+                sp++;
+                break;
+            case opcode::node:
+                stack[sp++] = nodes[ins.arg].eval( d );
+                break;
+            case opcode::jump_unless:
+                sp--;
+                if( !( stack[sp] > 0 ) ) {
+                    pc = static_cast<std::size_t>( ins.arg );
+                }
+                break;
+            case opcode::jump:
+                pc = static_cast<std::size_t>( ins.arg );
+                break;
+            case opcode::assign:
+                sp -= 2;
+                if constexpr( std::is_same_v<D, dialogue> ) {
+                    double const val = ins.bin( stack[sp], stack[sp + 1] );
+                    std::visit( [&d, val]( auto const & v ) {
+                        if constexpr( v_has_assign<decltype( v )> ) {
+                            v.assign( d, val );
+                        } else {
+                            throw math::internal_error(
+                                "math called assign() on unexpected node without assign()" );
+                        }
+                    }, nodes[ins.arg].data );
+                } else {
+                    throw math::runtime_error( "Cannot use assignment operators from eval context" );
+                }
+                stack[sp++] = 0;
+                break;
+        }
+    }
+    return stack[0];
+}
+
+double math_program::eval( const_dialogue const &d ) const
+{
+    return run( d );
+}
+
+double math_program::eval( dialogue &d ) const
+{
+    return run( d );
+}
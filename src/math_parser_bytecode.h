@@ -0,0 +1,90 @@
+#pragma once
+#ifndef CATA_SRC_MATH_PARSER_BYTECODE_H
+#define CATA_SRC_MATH_PARSER_BYTECODE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "math_parser_func.h"
+#include "math_parser_impl.h"
+#include "type_id.h"
+
+struct dialogue;
+struct const_dialogue;
+
+// A parsed math expression lowered into a flat program for a small stack machine.
+//
+// Constant subexpressions are folded at compile time, every distinct variable gets a slot that
+// is read at most once per evaluation, and evaluation runs on fixed-size arrays, so it does not
+// allocate. Dialogue functions, tripoint members and jmath functions are called through their
+// tree nodes as before.
+class math_program
+{
+    public:
+        // Most stack slots and variable slots a program may use. Deeper or wider expressions
+        // are not compiled and keep running as a tree.
+        static constexpr std::size_t max_stack = 32;
+        static constexpr std::size_t max_vars = 64;
+
+        // Lowers tree into this program. Returns false, leaving the program empty, if the tree
+        // has nodes that can't be evaluated or the expression exceeds the limits above.
+        bool compile( thingie const &tree );
+        bool empty() const {
+            return code.empty();
+        }
+
+        double eval( const_dialogue const &d ) const;
+        double eval( dialogue &d ) const;
+
+    private:
+        enum class opcode : int {
+            constant = 0,
+            // Pushes the variable in slot arg.
+            load,
+            // Pops two values and pushes bin( l, r ).
+            binary,
+            // Pops arg values and pushes fn( values ).
+            func,
+            // Pops arg values and pushes the jmath function jmaths[index] called with them.
+            jmath,
+            // Pushes the value of the tree node nodes[arg].
+            node,
+            // Pops a condition and jumps to arg unless it is positive.
+            jump_unless,
+            jump,
+            // Pops rhs and mhs and assigns bin( mhs, rhs ) to the target nodes[arg].
+            assign,
+        };
+        struct instruction {
+            opcode op = opcode::constant;
+            int arg = 0;
+            int index = 0;
+            double value = 0.0;
+            binary_op::f_t bin = nullptr;
+            math_func::f_t fn = nullptr;
+        };
+
+        std::vector<instruction> code;
+        std::vector<var> vars;
+        std::vector<thingie> nodes;
+        std::vector<jmath_func_id> jmaths;
+
+        // State while compiling.
+        int depth = 0;
+        int max_depth = 0;
+
+        bool compile_node( thingie const &t );
+        bool compile_oper( oper const &o );
+        bool compile_func( func const &f );
+        bool compile_jmath( func_jmath const &f );
+        bool compile_ternary( ternary const &t );
+        bool compile_assign( ass_oper const &a );
+        void emit( instruction const &ins, int stack_change );
+        // Whether the instructions from `first` on are a single constant.
+        bool is_constant_from( std::size_t first ) const;
+
+        template<typename D>
+        double run( D &d ) const;
+};
+
+#endif // CATA_SRC_MATH_PARSER_BYTECODE_H
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
 #include <string_view>
 #include <vector>
@@ -14,11 +15,42 @@
 #include "rng.h"
 #include "units.h"
 
+// The evaluated parameters of a math function call.
+struct math_func_args {
+    double const *first = nullptr;
+    std::size_t count = 0;
+
+    constexpr math_func_args() = default;
+    constexpr math_func_args( double const *first_, std::size_t count_ )
+        : first( first_ ), count( count_ ) {}
+    explicit math_func_args( std::vector<double> const &params )
+        : first( params.data() ), count( params.size() ) {}
+
+    double operator[]( std::size_t i ) const {
+        return first[i];
+    }
+    double const *begin() const {
+        return first;
+    }
+    double const *end() const {
+        return first + count;
+    }
+    bool empty() const {
+        return count == 0;
+    }
+    std::size_t size() const {
+        return count;
+    }
+};
+
 struct math_func {
     std::string_view symbol;
     int num_params;
-    using f_t = double ( * )( std::vector<double> const & );
+    using f_t = double ( * )( math_func_args const & );
     f_t f;
+    // Returns the same result for the same parameters and has no side effects, so calls with
+    // constant parameters may be folded when compiling.
+    bool pure = true;
 };
 using pmath_func = math_func const *;
 
@@ -28,12 +60,12 @@ struct math_const {
 };
 using pmath_const = math_const const *;
 
-inline double abs( std::vector<double> const &params )
+inline double abs( math_func_args const &params )
 {
     return std::abs( params[0] );
 }
 
-inline double max( std::vector<double> const &params )
+inline double max( math_func_args const &params )
 {
     if( params.empty() ) {
         return 0;
@@ -41,7 +73,7 @@ inline double max( std::vector<double> const &params )
     return *std::max_element( params.begin(), params.end() );
 }
 
-inline double min( std::vector<double> const &params )
+inline double min( math_func_args const &params )
 {
     if( params.empty() ) {
         return 0;
@@ -49,42 +81,42 @@ inline double min( std::vector<double> const &params )
     return *std::min_element( params.begin(), params.end() );
 }
 
-inline double math_rng( std::vector<double> const &params )
+inline double math_rng( math_func_args const &params )
 {
     return rng_float( params[0], params[1] );
 }
 
-inline double rand( std::vector<double> const &params )
+inline double rand( math_func_args const &params )
 {
     return rng( 0, static_cast<int>( std::round( params[0] ) ) );
 }
 
-inline double sqrt( std::vector<double> const &params )
+inline double sqrt( math_func_args const &params )
 {
     return std::sqrt( params[0] );
 }
 
-inline double log( std::vector<double> const &params )
+inline double log( math_func_args const &params )
 {
     return std::log( params[0] );
 }
 
-inline double sin( std::vector<double> const &params )
+inline double sin( math_func_args const &params )
 {
     return std::sin( params[0] );
 }
 
-inline double cos( std::vector<double> const &params )
+inline double cos( math_func_args const &params )
 {
     return std::cos( params[0] );
 }
 
-inline double tan( std::vector<double> const &params )
+inline double tan( math_func_args const &params )
 {
     return std::tan( params[0] );
 }
 
-inline double clamp( std::vector<double> const &params )
+inline double clamp( math_func_args const &params )
 {
     if( params[2] < params[1] ) {
         debugmsg( "clamp called with hi < lo (%f < %f)", params[2], params[1] );
@@ -93,47 +125,47 @@ inline double clamp( std::vector<double> const &params )
     return std::clamp( params[0], params[1], params[2] );
 }
 
-inline double floor( std::vector<double> const &params )
+inline double floor( math_func_args const &params )
 {
     return std::floor( params[0] );
 }
 
-inline double ceil( std::vector<double> const &params )
+inline double ceil( math_func_args const &params )
 {
     return std::ceil( params[0] );
 }
 
-inline double trunc( std::vector<double> const &params )
+inline double trunc( math_func_args const &params )
 {
     return std::trunc( params[0] );
 }
 
-inline double round( std::vector<double> const &params )
+inline double round( math_func_args const &params )
 {
     return std::round( params[0] );
 }
 
-constexpr double test_( std::vector<double> const &/* params */ )
+constexpr double test_( math_func_args const &/* params */ )
 {
     return 42;
 }
 
-inline double celsius_from_kelvin( std::vector<double> const &params )
+inline double celsius_from_kelvin( math_func_args const &params )
 {
     return units::to_celsius( units::from_kelvin( params[0] ) );
 }
 
-inline double fahrenheit_from_kelvin( std::vector<double> const &params )
+inline double fahrenheit_from_kelvin( math_func_args const &params )
 {
     return units::to_fahrenheit( units::from_kelvin( params[0] ) );
 }
 
-inline double celsius_to_kelvin( std::vector<double> const &params )
+inline double celsius_to_kelvin( math_func_args const &params )
 {
     return units::to_kelvin( units::from_celsius( params[0] ) );
 }
 
-inline double fahrenheit_to_kelvin( std::vector<double> const &params )
+inline double fahrenheit_to_kelvin( math_func_args const &params )
 {
     return units::to_kelvin( units::from_fahrenheit( params[0] ) );
 }
@@ -142,13 +174,13 @@ constexpr std::array<math_func, 20> functions{
     math_func{ "abs", 1, abs },
     math_func{ "max", -1, max },
     math_func{ "min", -1, min },
-    math_func{ "clamp", 3, clamp },
+    math_func{ "clamp", 3, clamp, false },
     math_func{ "floor", 1, floor },
     math_func{ "trunc", 1, trunc },
     math_func{ "ceil", 1, ceil },
     math_func{ "round", 1, round },
-    math_func{ "rng", 2, math_rng },
-    math_func{ "rand", 1, rand },
+    math_func{ "rng", 2, math_rng, false },
+    math_func{ "rand", 1, rand, false },
     math_func{ "sqrt", 1, sqrt },
     math_func{ "log", 1, log },
     math_func{ "sin", 1, sin },
@@ -2631,6 +2631,11 @@ diag_value const *const_dialogue::maybe_get_value( const std::string &key ) cons
     return global_variables::_common_maybe_get_value( key, context );
 }
 
+diag_value const *const_dialogue::maybe_get_value( const std::string &key, uint32_t slot ) const
+{
+    return global_variables::_common_maybe_get_value( key, slot, context );
+}
+
 void const_dialogue::set_conditional( const std::string &key,
                                       const std::function<bool( const_dialogue const & )> &value )
 {
@@ -2373,6 +2373,11 @@ void options_manager::add_options_graphics()
              to_translation( "If true, forces the game to redraw at least once per turn." ),
              true
            );
+
+        add( "FAST_FORWARD_FPS", page_id, to_translation( "Fast-forward frame rate" ),
+             to_translation( "Maximum frames per second drawn while the game runs turns without waiting for input, such as during activities, waiting, sleeping or auto-travel.  Redraws requested in between are skipped.  Set to 0 to draw every one of them." ),
+             0, 240, 30
+           );
     } );
 
     add_empty_line();
@@ -251,10 +251,34 @@ overmap::overmap( const point_abs_om &p ) : loc( p )
     settings = overmap_buffer.get_overmap_region( tripoint_abs_om( p, 0 ) );
     init_layers();
     hordes.set_location( loc );
+    bump_display_revision();
 }
 
 overmap::~overmap() = default;
 
+static uint64_t display_revision_counter = 0;
+
+uint64_t overmap::latest_display_revision()
+{
+    return display_revision_counter;
+}
+
+void overmap::bump_display_revision()
+{
+    display_revision_ = ++display_revision_counter;
+}
+
+void overmap::set_prefetched_noise( std::shared_ptr<const om_noise::om_noise_fields> noise )
+{
+    noise_fields = std::move( noise );
+}
+
+const cata::mdarray<float, point_om_omt> *overmap::noise_layer(
+    cata::mdarray<float, point_om_omt> om_noise::om_noise_fields::*layer ) const
+{
+    return noise_fields ? &( ( *noise_fields ).*layer ) : nullptr;
+}
+
 void overmap::populate( overmap_special_batch &enabled_specials )
 {
 
@@ -293,6 +317,7 @@ void overmap::populate( overmap_special_batch &enabled_specials )
     } catch( const std::exception &err ) {
         debugmsg( "overmap (%d,%d) failed to load: %s", loc.x(), loc.y(), err.what() );
     }
+    noise_fields.reset();
 }
 
 void overmap::populate()
@@ -364,7 +389,10 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
     }
     // TODO: maaaaybe this can be set after underlying map data has been changed? IDK.
     set_passable( project_combine( loc, p ), id->get_type_id()->default_map_data );
-    current_oter = id;
+    if( current_oter != id ) {
+        current_oter = id;
+        bump_display_revision();
+    }
 }
 
 const oter_id &overmap::ter( const tripoint_om_omt &p ) const
@@ -428,7 +456,11 @@ void overmap::set_seen( const tripoint_om_omt &p, om_vision_level val, bool forc
         return;
     }
 
-    layer[p.z() + OVERMAP_DEPTH].visible[p.xy()] = val;
+    om_vision_level &visible = layer[p.z() + OVERMAP_DEPTH].visible[p.xy()];
+    if( visible != val ) {
+        visible = val;
+        bump_display_revision();
+    }
 
     add_extra_note( p );
 }
@@ -956,6 +988,12 @@ void overmap::generate( const std::vector<const overmap *> &neighbor_overmaps,
         }
     }
 
+    if( !noise_fields ) {
+        // Evaluating the noise for the whole overmap at once is much faster than
+        // evaluating it as each point is needed.
+        noise_fields = om_noise::compute_noise_fields( global_base_point(), g->get_seed() );
+    }
+
     std::vector<Highway_path> highway_paths;
     calculate_urbanity();
     calculate_forestosity();
@@ -2045,7 +2083,8 @@ void overmap::place_forests()
 {
     const region_settings_forest &settings_forest = settings->get_settings_forest();
     const oter_id default_oter_id( settings->default_oter[OVERMAP_DEPTH] );
-    const om_noise::om_noise_layer_forest f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_forest f( global_base_point(), g->get_seed(),
+            noise_layer( &om_noise::om_noise_fields::forest ) );
 
     for( int x = 0; x < OMAPX; x++ ) {
         for( int y = 0; y < OMAPY; y++ ) {
@@ -2074,6 +2113,12 @@ bool overmap::omt_lake_noise_threshold( const point_abs_omt &origin, const point
                                         const double noise_threshold )
 {
     const om_noise::om_noise_layer_lake noise_func( origin, g->get_seed() );
+    return omt_lake_noise_threshold( noise_func, offset, noise_threshold );
+}
+
+bool overmap::omt_lake_noise_threshold( const om_noise::om_noise_layer_lake &noise_func,
+                                        const point_om_omt &offset, const double noise_threshold )
+{
     // credit to ehughsbaird for thinking up this inbounds solution to infinite flood fill lag.
     bool inbounds = offset.x() > -5 && offset.y() > -5 && offset.x() < OMAPX + 5 &&
                     offset.y() < OMAPY + 5;
@@ -2134,7 +2179,8 @@ void overmap::place_swamps()
     }
 
     // Get a layer of noise to use in conjunction with our river buffered floodplain.
-    const om_noise::om_noise_layer_floodplain f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_floodplain f( global_base_point(), g->get_seed(),
+            noise_layer( &om_noise::om_noise_fields::floodplain ) );
 
     for( int x = 0; x < OMAPX; x++ ) {
         for( int y = 0; y < OMAPY; y++ ) {
@@ -3581,7 +3627,8 @@ void overmap::place_mongroups()
     if( settings->overmap_ocean ) {
         // Now place ocean mongroup. Weights may need to be altered.
         const region_settings_ocean &settings_ocean = settings->get_settings_ocean();
-        const om_noise::om_noise_layer_ocean f( global_base_point(), g->get_seed() );
+        const om_noise::om_noise_layer_ocean f( global_base_point(), g->get_seed(),
+                noise_layer( &om_noise::om_noise_fields::ocean ) );
         const point_abs_om this_om = pos();
         const bool oceans_disabled = !settings_ocean.ocean_start_north.has_value() &&
                                      !settings_ocean.ocean_start_east.has_value() &&
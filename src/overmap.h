@@ -63,6 +63,12 @@ struct map_data_summary;
 struct region_settings;
 template <typename T> struct enum_traits;
 
+namespace om_noise
+{
+class om_noise_layer_lake;
+struct om_noise_fields;
+} // namespace om_noise
+
 struct om_note {
     std::string text;
     point_om_omt p;
@@ -454,6 +460,11 @@ class overmap
          **/
         void populate( overmap_special_batch &enabled_specials );
         void populate();
+        /**
+         * Hand over noise computed ahead of time by the overmapbuffer, so generation
+         * can read it instead of evaluating the noise functions itself.
+         */
+        void set_prefetched_noise( std::shared_ptr<const om_noise::om_noise_fields> noise );
 
         const point_abs_om &pos() const {
             return loc;
@@ -464,6 +475,8 @@ class overmap
         //will this OMT contain a lake before or after it is generated?
         static bool omt_lake_noise_threshold( const point_abs_omt &origin, const point_om_omt &offset,
                                               double noise_threshold );
+        static bool omt_lake_noise_threshold( const om_noise::om_noise_layer_lake &noise_func,
+                                              const point_om_omt &offset, double noise_threshold );
         //does the overmap have at least one lake OMT?
         //TODO: extend pre-determined lake generation so we know instead of guess
         static bool guess_has_lake( const point_abs_om &p, double noise_threshold, int tile_count );
@@ -506,6 +519,15 @@ class overmap
         bool seen_more_than( const tripoint_om_omt &p, om_vision_level test ) const;
         bool &explored( const tripoint_om_omt &p );
         bool is_explored( const tripoint_om_omt &p ) const;
+        /**
+         * Changes whenever terrain or vision on this overmap changes, so caches derived
+         * from them can tell when they are stale. Never shared between two overmaps.
+         */
+        uint64_t display_revision() const {
+            return display_revision_;
+        }
+        /** The most recent display revision handed out to any overmap. */
+        static uint64_t latest_display_revision();
 
         bool has_note( const tripoint_om_omt &p ) const;
         bool is_marked_dangerous( const tripoint_om_omt &p ) const;
@@ -662,6 +684,8 @@ class overmap
         // overmap::seen and overmap::explored
         bool nullbool = false; // NOLINT(cata-serialize)
         point_abs_om loc; // NOLINT(cata-serialize)
+        uint64_t display_revision_ = 0; // NOLINT(cata-serialize)
+        void bump_display_revision();
         // Random point used for special connections if there's no cities on the overmap, joins to all roads_out
         std::optional<point_om_omt> fallback_road_connection_point; // NOLINT(cata-serialize)
 
@@ -893,6 +917,12 @@ class overmap
         float forest_size_adjust = 0.0f;
         // NOLINTNEXTLINE(cata-serialize)
         float forestosity = 0.0f;
+        // Noise layers for the whole overmap, either prefetched or computed at the start of
+        // generation. Only held until generation is done.
+        // NOLINTNEXTLINE(cata-serialize)
+        std::shared_ptr<const om_noise::om_noise_fields> noise_fields;
+        const cata::mdarray<float, point_om_omt> *noise_layer(
+            cata::mdarray<float, point_om_omt> om_noise::om_noise_fields::*layer ) const;
         void calculate_urbanity();
         void calculate_forestosity();
 
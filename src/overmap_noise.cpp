@@ -1,5 +1,7 @@
 #include <cmath>
 #include <algorithm>
+#include <array>
+#include <memory>
 
 #include "overmap_noise.h"
 #include "simplexnoise.h"
@@ -7,7 +9,31 @@
 namespace om_noise
 {
 
-float om_noise_layer_forest::noise_at( const point_om_omt &local_omt_pos ) const
+void om_noise_layer::compute_noise_grid( cata::mdarray<float, point_om_omt> &out ) const
+{
+    for( int x = 0; x < OMAPX; x++ ) {
+        for( int y = 0; y < OMAPY; y++ ) {
+            out[x][y] = compute_noise_at( point_om_omt( x, y ) );
+        }
+    }
+}
+
+void om_noise_layer::octave_noise_column( const int local_x, const float octaves,
+        const float persistence, const float scale,
+        cata::mdarray<float, point_om_omt>::column_type &out ) const
+{
+    const point_abs_omt column_start = global_omt_pos( point_om_omt( local_x, 0 ) );
+    cata::mdarray<float, point_om_omt>::column_type xs;
+    cata::mdarray<float, point_om_omt>::column_type ys;
+    for( size_t y = 0; y < out.size(); y++ ) {
+        xs[y] = static_cast<float>( column_start.x() );
+        ys[y] = static_cast<float>( column_start.y() + static_cast<int>( y ) );
+    }
+    scaled_octave_noise_3d_batch( octaves, persistence, scale, 0, 1, xs.data(), ys.data(),
+                                  get_seed(), out.data(), out.size() );
+}
+
+float om_noise_layer_forest::compute_noise_at( const point_om_omt &local_omt_pos ) const
 {
     const point_abs_omt p = global_omt_pos( local_omt_pos );
     float r = scaled_octave_noise_3d( 4, 0.5, 0.03, 0, 1, p.x(), p.y(), get_seed() );
@@ -19,7 +45,20 @@ float om_noise_layer_forest::noise_at( const point_om_omt &local_omt_pos ) const
     return std::max( 0.0f, r - d * 0.5f );
 }
 
-float om_noise_layer_floodplain::noise_at( const point_om_omt &local_omt_pos ) const
+void om_noise_layer_forest::compute_noise_grid( cata::mdarray<float, point_om_omt> &out ) const
+{
+    cata::mdarray<float, point_om_omt>::column_type d;
+    for( int x = 0; x < OMAPX; x++ ) {
+        cata::mdarray<float, point_om_omt>::column_type &r = out[x];
+        octave_noise_column( x, 4, 0.5, 0.03, r );
+        octave_noise_column( x, 6, 0.5, 0.07, d );
+        for( size_t y = 0; y < r.size(); y++ ) {
+            r[y] = std::max( 0.0f, std::pow( r[y], 2.0f ) - std::pow( d[y], 3.0f ) * 0.5f );
+        }
+    }
+}
+
+float om_noise_layer_floodplain::compute_noise_at( const point_om_omt &local_omt_pos ) const
 {
     const point_abs_omt p = global_omt_pos( local_omt_pos );
     float r = scaled_octave_noise_3d( 4, 0.5, 0.05, 0, 1, p.x(), p.y(), get_seed() );
@@ -27,7 +66,18 @@ float om_noise_layer_floodplain::noise_at( const point_om_omt &local_omt_pos ) c
     return r;
 }
 
-float om_noise_layer_lake::noise_at( const point_om_omt &local_omt_pos ) const
+void om_noise_layer_floodplain::compute_noise_grid( cata::mdarray<float, point_om_omt> &out ) const
+{
+    for( int x = 0; x < OMAPX; x++ ) {
+        cata::mdarray<float, point_om_omt>::column_type &r = out[x];
+        octave_noise_column( x, 4, 0.5, 0.05, r );
+        for( float &v : r ) {
+            v = std::pow( v, 2.0f );
+        }
+    }
+}
+
+float om_noise_layer_lake::compute_noise_at( const point_om_omt &local_omt_pos ) const
 {
     const point_abs_omt p = global_omt_pos( local_omt_pos );
     float r = scaled_octave_noise_3d( 8, 0.5, 0.002, 0, 1, p.x(), p.y(), get_seed() );
@@ -35,7 +85,18 @@ float om_noise_layer_lake::noise_at( const point_om_omt &local_omt_pos ) const
     return r;
 }
 
-float om_noise_layer_ocean::noise_at( const point_om_omt &local_omt_pos ) const
+void om_noise_layer_lake::compute_noise_grid( cata::mdarray<float, point_om_omt> &out ) const
+{
+    for( int x = 0; x < OMAPX; x++ ) {
+        cata::mdarray<float, point_om_omt>::column_type &r = out[x];
+        octave_noise_column( x, 8, 0.5, 0.002, r );
+        for( float &v : r ) {
+            v = std::pow( v, 4.0f );
+        }
+    }
+}
+
+float om_noise_layer_ocean::compute_noise_at( const point_om_omt &local_omt_pos ) const
 {
     // this is a duplicate of lake noise.  Changing it might cause artifacts if oceans
     // and lakes intersect.
@@ -45,4 +106,16 @@ float om_noise_layer_ocean::noise_at( const point_om_omt &local_omt_pos ) const
     return r;
 }
 
+std::shared_ptr<const om_noise_fields> compute_noise_fields( const point_abs_omt &global_base_point,
+        const unsigned seed )
+{
+    std::shared_ptr<om_noise_fields> fields = std::make_shared<om_noise_fields>();
+    om_noise_layer_forest( global_base_point, seed ).noise_grid( fields->forest );
+    om_noise_layer_floodplain( global_base_point, seed ).noise_grid( fields->floodplain );
+    om_noise_layer_lake( global_base_point, seed ).noise_grid( fields->lake );
+    // Ocean noise is the same function as lake noise, see om_noise_layer_ocean.
+    fields->ocean = fields->lake;
+    return fields;
+}
+
 } // namespace om_noise
@@ -2,16 +2,21 @@
 #ifndef CATA_SRC_OVERMAP_NOISE_H
 #define CATA_SRC_OVERMAP_NOISE_H
 
+#include <memory>
+
 #include "coordinates.h"
 #include "game_constants.h"
+#include "mdarray.h"
 #include "point.h"
+#include "simplexnoise.h"
 
 namespace om_noise
 {
 
 /**
  * Abstract base class for generating noise for usage in overmap generation.
- * Subclass it and implement noise_at.
+ * Subclass it and implement compute_noise_at, and compute_noise_grid if the noise
+ * can be computed faster for the whole overmap at once.
  */
 class om_noise_layer
 {
@@ -20,7 +25,29 @@ class om_noise_layer
          * Noise value at the provided overmap terrain location.
          * @param omt_local point location in overmap terrain local coordinates.
          */
-        virtual float noise_at( const point_om_omt &omt_local ) const = 0;
+        float noise_at( const point_om_omt &omt_local ) const {
+            if( precomputed != nullptr && omt_local.x() >= 0 && omt_local.y() >= 0 &&
+                omt_local.x() < OMAPX && omt_local.y() < OMAPY ) {
+                return ( *precomputed )[omt_local];
+            }
+            return compute_noise_at( omt_local );
+        }
+        /**
+         * Noise values at every point of the overmap, the same as calling noise_at for
+         * each of them.
+         */
+        void noise_grid( cata::mdarray<float, point_om_omt> &out ) const {
+            if( precomputed != nullptr ) {
+                out = *precomputed;
+                return;
+            }
+            if( !octave_noise_3d_batch_vectorized ) {
+                // The subclasses' grid arithmetic could be fused differently from noise_at's.
+                om_noise_layer::compute_noise_grid( out );
+                return;
+            }
+            compute_noise_grid( out );
+        }
         virtual ~om_noise_layer() = default;
     protected:
         /**
@@ -28,13 +55,28 @@ class om_noise_layer
          * overmaps will ensure that the noise is continuous across overmap boundaries.
          * @param global_base_point the (0, 0) corner of the overmap in global coordinates.
          * @param seed the seed to use for seeding the noise--conventionally the game's seed.
+         * @param precomputed if not null, values for the points inside the overmap are read from
+         * here instead of being computed.
          */
-        om_noise_layer( const point_abs_omt &global_base_point, const unsigned seed ) :
+        om_noise_layer( const point_abs_omt &global_base_point, const unsigned seed,
+                        const cata::mdarray<float, point_om_omt> *precomputed ) :
             om_global_base_point( global_base_point ),
             // Narrowing conversion into float, as the noise functions we use only accept floats.
-            seed( seed % SIMPLEX_NOISE_RANDOM_SEED_LIMIT ) {
+            seed( seed % SIMPLEX_NOISE_RANDOM_SEED_LIMIT ),
+            precomputed( precomputed ) {
         }
 
+        virtual float compute_noise_at( const point_om_omt &omt_local ) const = 0;
+        // The default implementation calls compute_noise_at for each point.
+        virtual void compute_noise_grid( cata::mdarray<float, point_om_omt> &out ) const;
+
+        /**
+         * scaled_octave_noise_3d, scaled to [0, 1], for all points of the column at the
+         * provided local x coordinate.
+         */
+        void octave_noise_column( int local_x, float octaves, float persistence, float scale,
+                                  cata::mdarray<float, point_om_omt>::column_type &out ) const;
+
         point_abs_omt global_omt_pos( const point_om_omt &local_omt_pos ) const {
             return om_global_base_point + local_omt_pos.raw();
         }
@@ -46,49 +88,77 @@ class om_noise_layer
     private:
         point_abs_omt om_global_base_point;
         float seed;
+        const cata::mdarray<float, point_om_omt> *precomputed;
 };
 
 class om_noise_layer_forest : public om_noise_layer
 {
     public:
-        om_noise_layer_forest( const point_abs_omt &global_base_point, unsigned seed )
-            : om_noise_layer( global_base_point, seed ) {
+        om_noise_layer_forest( const point_abs_omt &global_base_point, unsigned seed,
+                             const cata::mdarray<float, point_om_omt> *precomputed = nullptr )
+            : om_noise_layer( global_base_point, seed, precomputed ) {
         }
 
-        float noise_at( const point_om_omt &local_omt_pos ) const override;
+    protected:
+        float compute_noise_at( const point_om_omt &local_omt_pos ) const override;
+        void compute_noise_grid( cata::mdarray<float, point_om_omt> &out ) const override;
 };
 
 class om_noise_layer_floodplain : public om_noise_layer
 {
     public:
-        om_noise_layer_floodplain( const point_abs_omt &global_base_point, unsigned seed )
-            : om_noise_layer( global_base_point, seed ) {
+        om_noise_layer_floodplain( const point_abs_omt &global_base_point, unsigned seed,
+                             const cata::mdarray<float, point_om_omt> *precomputed = nullptr )
+            : om_noise_layer( global_base_point, seed, precomputed ) {
         }
 
-        float noise_at( const point_om_omt &local_omt_pos ) const override;
+    protected:
+        float compute_noise_at( const point_om_omt &local_omt_pos ) const override;
+        void compute_noise_grid( cata::mdarray<float, point_om_omt> &out ) const override;
 };
 
 class om_noise_layer_lake : public om_noise_layer
 {
     public:
-        om_noise_layer_lake( const point_abs_omt &global_base_point, unsigned seed )
-            : om_noise_layer( global_base_point, seed ) {
+        om_noise_layer_lake( const point_abs_omt &global_base_point, unsigned seed,
+                             const cata::mdarray<float, point_om_omt> *precomputed = nullptr )
+            : om_noise_layer( global_base_point, seed, precomputed ) {
         }
 
-        float noise_at( const point_om_omt &local_omt_pos ) const override;
+    protected:
+        float compute_noise_at( const point_om_omt &local_omt_pos ) const override;
+        void compute_noise_grid( cata::mdarray<float, point_om_omt> &out ) const override;
 };
 
 
 class om_noise_layer_ocean : public om_noise_layer
 {
     public:
-        om_noise_layer_ocean( const point_abs_omt &global_base_point, unsigned seed )
-            : om_noise_layer( global_base_point, seed ) {
+        om_noise_layer_ocean( const point_abs_omt &global_base_point, unsigned seed,
+                             const cata::mdarray<float, point_om_omt> *precomputed = nullptr )
+            : om_noise_layer( global_base_point, seed, precomputed ) {
         }
 
-        float noise_at( const point_om_omt &local_omt_pos ) const override;
+    protected:
+        float compute_noise_at( const point_om_omt &local_omt_pos ) const override;
 };
 
+/**
+ * Every noise layer evaluated at every point of one overmap.
+ *
+ * The noise only depends on the world seed and the overmap position, so this can be computed
+ * ahead of time (and off the main thread) for overmaps that are about to be generated.
+ */
+struct om_noise_fields {
+    cata::mdarray<float, point_om_omt> forest;
+    cata::mdarray<float, point_om_omt> floodplain;
+    cata::mdarray<float, point_om_omt> lake;
+    cata::mdarray<float, point_om_omt> ocean;
+};
+
+std::shared_ptr<const om_noise_fields> compute_noise_fields( const point_abs_omt &global_base_point,
+        unsigned seed );
+
 } // namespace om_noise
 
 #endif // CATA_SRC_OVERMAP_NOISE_H
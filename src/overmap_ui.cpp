@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -55,6 +56,7 @@
 #include "mapdata.h"
 #include "mapgen_parameter.h"
 #include "mapgendata.h"
+#include "mdarray.h"
 #include "messages.h"
 #include "mission.h"
 #include "mongroup.h"
@@ -2497,6 +2499,103 @@ oter_vision::blended_omt oter_vision::get_blended_omt_info( const tripoint_abs_o
     return ret;
 }
 
+namespace
+{
+
+// The terrain glyph of each OMT, which is all that is left once none of the overlays in
+// oter_symbol_and_color apply. Blended tiles survey their whole neighbourhood to find it,
+// so it is worth remembering until terrain or vision around the tile changes.
+class omt_glyph_cache
+{
+    public:
+        struct glyph {
+            std::string sym;
+            nc_color color;
+            // Whether the glyph was borrowed from the neighbours, which means the
+            // explored status of the tile itself does not apply to it.
+            bool blended = false;
+            // Unseen tiles never reach the terrain layer, so this marks an empty slot.
+            om_vision_level vision = om_vision_level::unseen;
+        };
+
+        template<typename F>
+        const glyph &get( const tripoint_abs_omt &omp, om_vision_level vision, F &&compute ) {
+            if( land_use_codes != uistate.overmap_show_land_use_codes ||
+                forest_trails != uistate.overmap_show_forest_trails ) {
+                land_use_codes = uistate.overmap_show_land_use_codes;
+                forest_trails = uistate.overmap_show_forest_trails;
+                layers.clear();
+                last_layer = nullptr;
+            }
+            point_abs_om om;
+            point_om_omt local;
+            std::tie( om, local ) = project_remain<coords::om>( omp.xy() );
+            glyph &slot = layer_for( tripoint_abs_om( om, omp.z() ) ).glyphs[local];
+            if( slot.vision != vision ) {
+                slot = compute();
+                slot.vision = vision;
+            }
+            return slot;
+        }
+
+    private:
+        struct layer {
+            // display_revision() of the overmap and its eight neighbours, since blending
+            // reaches past the edge of the overmap. Zero stands for a missing overmap.
+            std::array<uint64_t, 9> revisions = {};
+            uint64_t checked_at = 0;
+            cata::mdarray<glyph, point_om_omt> glyphs;
+        };
+
+        // A layer holds 180x180 glyphs of 48 bytes each, about 1.5 MB before any symbol
+        // outgrows the small string buffer. The overmap window rarely spans more than
+        // four overmaps, so eight layers (about 12 MB) leaves room for a z-level change.
+        static constexpr size_t max_layers = 8;
+
+        layer &layer_for( const tripoint_abs_om &key ) {
+            const uint64_t latest = overmap::latest_display_revision();
+            if( last_layer != nullptr && last_key == key && last_layer->checked_at == latest ) {
+                return *last_layer;
+            }
+            auto it = layers.find( key );
+            if( it == layers.end() ) {
+                if( layers.size() >= max_layers ) {
+                    layers.clear();
+                }
+                it = layers.emplace( key, std::make_unique<layer>() ).first;
+            }
+            layer &l = *it->second;
+            if( l.checked_at != latest ) {
+                std::array<uint64_t, 9> revisions;
+                size_t i = 0;
+                for( int y = -1; y <= 1; ++y ) {
+                    for( int x = -1; x <= 1; ++x ) {
+                        const overmap *om = overmap_buffer.get_existing( key.xy() + point( x, y ) );
+                        revisions[i++] = om != nullptr ? om->display_revision() : 0;
+                    }
+                }
+                if( revisions != l.revisions ) {
+                    l.glyphs.fill( glyph() );
+                    l.revisions = revisions;
+                }
+                l.checked_at = latest;
+            }
+            last_key = key;
+            last_layer = &l;
+            return l;
+        }
+
+        std::unordered_map<tripoint_abs_om, std::unique_ptr<layer>> layers;
+        tripoint_abs_om last_key;
+        layer *last_layer = nullptr;
+        bool land_use_codes = false;
+        bool forest_trails = false;
+};
+
+omt_glyph_cache omt_glyphs;
+
+} // namespace
+
 std::pair<std::string, nc_color> oter_display_lru::get_symbol_and_color( const oter_id &cur_ter,
         om_vision_level vision )
 {
@@ -2656,29 +2755,31 @@ std::pair<std::string, nc_color> oter_symbol_and_color( const tripoint_abs_omt &
     } else if( !opts.sZoneName.empty() && opts.tripointZone.xy() == omp.xy() ) {
         ret.second = c_yellow;
         ret.first = "Z";
-    } else if( cur_ter->blends_adjacent( args.vision ) ) {
-        oter_vision::blended_omt here = oter_vision::get_blended_omt_info( omp, args.vision );
-        ret.first = here.sym;
-        ret.second = here.color;
-    } else if( !uistate.overmap_show_forest_trails && cur_ter &&
-               ( cur_ter->get_type_id() == oter_type_forest_trail ) ) {
-        // If forest trails shouldn't be displayed, and this is a forest trail, then
-        // instead render it like a forest.
-        ret = lru ? lru->get_symbol_and_color( oter_forest.id(),
-        args.vision ) : std::pair<std::string, nc_color> {
-            oter_forest->get_symbol( args.vision, uistate.overmap_show_land_use_codes ),
-            oter_forest->get_color( args.vision, uistate.overmap_show_land_use_codes )
-        };
-        if( opts.show_explored && overmap_buffer.is_explored( omp ) ) {
-            ret.second = c_dark_gray;
-        }
     } else {
         // Nothing special, but is visible to the player.
-        ret = lru ? lru->get_symbol_and_color( cur_ter, args.vision ) : std::pair<std::string, nc_color> {
-            cur_ter->get_symbol( args.vision, uistate.overmap_show_land_use_codes ),
-            cur_ter->get_color( args.vision, uistate.overmap_show_land_use_codes )
-        };
-        if( opts.show_explored && overmap_buffer.is_explored( omp ) ) {
+        const omt_glyph_cache::glyph &here = omt_glyphs.get( omp, args.vision, [&]() {
+            omt_glyph_cache::glyph fresh;
+            std::pair<std::string, nc_color> sym_color;
+            if( cur_ter->blends_adjacent( args.vision ) ) {
+                oter_vision::blended_omt blended = oter_vision::get_blended_omt_info( omp, args.vision );
+                sym_color = { blended.sym, blended.color };
+                fresh.blended = true;
+            } else {
+                // If forest trails shouldn't be displayed, and this is a forest trail, then
+                // instead render it like a forest.
+                const oter_id &shown = !uistate.overmap_show_forest_trails &&
+                                       cur_ter->get_type_id() == oter_type_forest_trail ? oter_forest.id() : cur_ter;
+                sym_color = lru ? lru->get_symbol_and_color( shown, args.vision ) :
+                std::pair<std::string, nc_color> {
+                    shown->get_symbol( args.vision, uistate.overmap_show_land_use_codes ),
+                    shown->get_color( args.vision, uistate.overmap_show_land_use_codes )
+                };
+            }
+            std::tie( fresh.sym, fresh.color ) = std::move( sym_color );
+            return fresh;
+        } );
+        ret = { here.sym, here.color };
+        if( !here.blended && opts.show_explored && overmap_buffer.is_explored( omp ) ) {
             ret.second = c_dark_gray;
         }
     }
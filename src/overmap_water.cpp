@@ -259,7 +259,8 @@ void overmap::river_meander( const point_om_omt &river_end, tripoint_om_omt &cur
 void overmap::place_lakes( const std::vector<const overmap *> &neighbor_overmaps )
 {
     const point_abs_omt origin = global_base_point();
-    const om_noise::om_noise_layer_lake noise_func( origin, g->get_seed() );
+    const om_noise::om_noise_layer_lake noise_func( origin, g->get_seed(),
+            noise_layer( &om_noise::om_noise_fields::lake ) );
     const region_settings_lake &settings_lake = settings->get_settings_lake();
     double noise_threshold = settings_lake.noise_threshold_lake;
     const int lake_depth = settings_lake.lake_depth;
@@ -271,7 +272,8 @@ void overmap::place_lakes( const std::vector<const overmap *> &neighbor_overmaps
             point_om_omt( OMAPX + 5, OMAPY + 5 ) );
     const auto is_lake = [&]( const point_om_omt & p ) {
         return considered_bounds.contains( p ) &&
-               settings_lake.invert_lakes ^ omt_lake_noise_threshold( origin, p, noise_threshold );
+               settings_lake.invert_lakes ^
+               omt_lake_noise_threshold( noise_func, p, noise_threshold );
     };
 
     // We'll keep track of our visited lake points so we don't repeat the work.
@@ -407,7 +409,8 @@ void overmap::place_oceans( const std::vector<const overmap *> &neighbor_overmap
                                  !settings_ocean.ocean_start_east.has_value() &&
                                  !settings_ocean.ocean_start_west.has_value() && !settings_ocean.ocean_start_south.has_value();
 
-    const om_noise::om_noise_layer_ocean f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_ocean f( global_base_point(), g->get_seed(),
+            noise_layer( &om_noise::om_noise_fields::ocean ) );
     const point_abs_om this_om = pos();
 
     const auto is_ocean = [&]( const point_om_omt & p ) {
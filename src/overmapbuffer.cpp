@@ -15,6 +15,7 @@
 #include "basecamp.h"
 #include "calendar.h"
 #include "cata_assert.h"
+#include "cata_thread_pool.h"
 #include "cata_utility.h"
 #include "character.h"
 #include "character_id.h"
@@ -44,6 +45,7 @@
 #include "options.h"
 #include "overmap.h"
 #include "overmap_connection.h"
+#include "overmap_noise.h"
 #include "overmap_types.h"
 #include "path_info.h"
 #include "point.h"
@@ -59,6 +61,8 @@ static const oter_type_str_id oter_type_bridgehead_ground( "bridgehead_ground" )
 static const oter_type_str_id oter_type_bridgehead_ramp( "bridgehead_ramp" );
 
 static const int default_search_range = OMAPX * 5;
+// How close to the edge of an overmap one has to be to start preparing the overmap beyond.
+static const int overmap_prefetch_distance = OMAPX / 4;
 
 // Moved from obsolete coordinate_conversions.h to its only remaining user.
 static int omt_to_sm_copy( int a )
@@ -112,6 +116,7 @@ overmap &overmapbuffer::get( const point_abs_om &p )
     // That constructor loads an existing overmap or creates a new one.
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
     global_state.overmap_count++;
+    new_om.set_prefetched_noise( take_prefetched_noise( p ) );
     new_om.populate();
     // Note: fix_mongroups might load other overmaps, so overmaps.back() is not
     // necessarily the overmap at (x,y)
@@ -135,6 +140,68 @@ void overmapbuffer::create_custom_overmap( const point_abs_om &p, overmap_specia
     new_om.populate( specials );
 }
 
+void overmapbuffer::prefetch_near( const tripoint_abs_omt &p )
+{
+    point_abs_om om_pos;
+    point_om_omt local;
+    std::tie( om_pos, local ) = project_remain<coords::om>( p.xy() );
+    const int dx = local.x() < overmap_prefetch_distance ? -1 :
+                   local.x() >= OMAPX - overmap_prefetch_distance ? 1 : 0;
+    const int dy = local.y() < overmap_prefetch_distance ? -1 :
+                   local.y() >= OMAPY - overmap_prefetch_distance ? 1 : 0;
+
+    std::vector<point_abs_om> wanted;
+    if( dx != 0 ) {
+        wanted.emplace_back( om_pos + point( dx, 0 ) );
+    }
+    if( dy != 0 ) {
+        wanted.emplace_back( om_pos + point( 0, dy ) );
+    }
+    if( dx != 0 && dy != 0 ) {
+        wanted.emplace_back( om_pos + point( dx, dy ) );
+    }
+
+    // Drop what we prepared for overmaps we moved away from.
+    for( auto it = noise_prefetches.begin(); it != noise_prefetches.end(); ) {
+        if( std::find( wanted.begin(), wanted.end(), it->first ) == wanted.end() ) {
+            it = noise_prefetches.erase( it );
+        } else {
+            ++it;
+        }
+    }
+
+    const unsigned seed = g->get_seed();
+    for( const point_abs_om &om : wanted ) {
+        // Overmaps saved on disk are not checked for here, as that would mean loading them.
+        // Preparing one of those is wasted work, but nothing else.
+        if( overmaps.count( om ) > 0 || noise_prefetches.count( om ) > 0 ) {
+            continue;
+        }
+        const point_abs_omt base = project_to<coords::omt>( om );
+        std::future<std::shared_ptr<const om_noise::om_noise_fields>> fields =
+        cata::background_workers().submit( [base, seed]() {
+            return om_noise::compute_noise_fields( base, seed );
+        } );
+        noise_prefetches.emplace( om, noise_prefetch{ seed, std::move( fields ) } );
+    }
+}
+
+std::shared_ptr<const om_noise::om_noise_fields> overmapbuffer::take_prefetched_noise(
+    const point_abs_om &p )
+{
+    const auto it = noise_prefetches.find( p );
+    if( it == noise_prefetches.end() ) {
+        return nullptr;
+    }
+    noise_prefetch prefetch = std::move( it->second );
+    noise_prefetches.erase( it );
+    // The world (and with it the seed) may have changed since the prefetch was started.
+    if( prefetch.seed != g->get_seed() ) {
+        return nullptr;
+    }
+    return prefetch.fields.get();
+}
+
 void overmapbuffer::fix_mongroups( overmap &new_overmap )
 {
     for( auto it = new_overmap.zg.begin(); it != new_overmap.zg.end(); ) {
@@ -255,6 +322,7 @@ void overmapbuffer::save()
 void overmapbuffer::reset()
 {
     overmaps.clear();
+    noise_prefetches.clear();
     global_state.highway_intersections.clear();
     last_requested_overmap = nullptr;
 }
@@ -262,6 +330,7 @@ void overmapbuffer::reset()
 void overmapbuffer::clear()
 {
     overmaps.clear();
+    noise_prefetches.clear();
     known_non_existing.clear();
     global_state.clear();
     last_requested_overmap = nullptr;
@@ -5,6 +5,7 @@
 #include <array>
 #include <bitset>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <optional>
@@ -197,6 +198,11 @@ struct overmap_global_state {
     void serialize( JsonOut &json ) const;
 };
 
+namespace om_noise
+{
+struct om_noise_fields;
+} // namespace om_noise
+
 class overmapbuffer
 {
     public:
@@ -223,6 +229,16 @@ class overmapbuffer
         void reset();
         void clear();
         void create_custom_overmap( const point_abs_om &, overmap_special_batch &specials );
+        /**
+         * Starts preparing, on background threads, the overmaps the given point is close to
+         * that have not been created yet. Only work that depends on nothing but the world
+         * seed and the overmap position is done ahead of time, so the generated overmaps are
+         * identical to the ones generated without prefetching.
+         * For now that is only the forest, floodplain, lake and ocean noise layers. Placing cities,
+         * roads and specials, and the bookkeeping in @ref global_state, still happen on the
+         * main thread once the overmap is actually requested.
+         */
+        void prefetch_near( const tripoint_abs_omt &p );
 
         /**
          * Returns the overmap terrain at the given OMT coordinates.
@@ -678,6 +694,16 @@ class overmapbuffer
         // Cached result of previous call to overmapbuffer::get_existing
         overmap mutable *last_requested_overmap;
 
+        struct noise_prefetch {
+            unsigned seed;
+            std::future<std::shared_ptr<const om_noise::om_noise_fields>> fields;
+        };
+        // Noise for not yet created overmaps, see @ref prefetch_near.
+        std::unordered_map<point_abs_om, noise_prefetch> noise_prefetches;
+        // Waits for and removes the prefetched noise of the overmap, if any.
+        std::shared_ptr<const om_noise::om_noise_fields> take_prefetched_noise(
+            const point_abs_om &p );
+
         /**
          * Get a list of notes in the (loaded) overmaps.
          * @param z only this specific z-level is search for notes.
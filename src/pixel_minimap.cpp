@@ -242,6 +242,7 @@ void pixel_minimap::prepare_cache_for_updates( const tripoint_bub_ms &center )
 {
     const tripoint_abs_sm new_center_sm = center_to_abs_sm( center );
     const tripoint_rel_sm center_sm_diff = cached_center_sm - new_center_sm;
+    const bool nv_goggle = get_player_character().get_vision_modes()[NV_GOGGLES];
 
     //invalidate the cache if the game shifted more than one submap in the last update, or if z-level changed.
     if( std::abs( center_sm_diff.x() ) > 1 ||
@@ -251,10 +252,14 @@ void pixel_minimap::prepare_cache_for_updates( const tripoint_bub_ms &center )
     } else {
         for( auto &mcp : cache ) {
             mcp.second.touched = false;
+            if( nv_goggle != cached_nv_goggle ) {
+                mcp.second.complete = false;
+            }
         }
     }
 
     cached_center_sm = new_center_sm;
+    cached_nv_goggle = nv_goggle;
 }
 
 //deletes the mapping of unused submap caches from the main map
@@ -340,10 +345,18 @@ void pixel_minimap::update_cache_at( const tripoint_bub_sm &sm_pos )
     const tripoint_bub_ms ms_pos = coords::project_to<coords::ms>( sm_pos );
 
     cache_item.touched = true;
+    // A submap seen for the first time is colored in full, after that only the
+    // tiles whose terrain, furniture, vehicle or lighting changed since.
+    const bool recolor_all = !cache_item.complete;
+    cache_item.complete = true;
 
     for( int y = 0; y < SEEY; ++y ) {
         for( int x = 0; x < SEEX; ++x ) {
             const tripoint_bub_ms p = ms_pos + tripoint{x, y, 0};
+            if( !recolor_all && !here.minimap_cache_is_dirty( p ) ) {
+                continue;
+            }
+            here.minimap_cache_set_dirty( p, false );
             const lit_level lighting = access_cache.visibility_cache[p.x()][p.y()];
 
             SDL_Color color;
@@ -66,6 +66,9 @@ class pixel_minimap
             std::array<SDL_Color, SEEX *SEEY> minimap_colors = {};
             //checks if the submap has been looked at by the minimap routine
             bool touched = false;
+            //set once every tile was colored; afterwards only the tiles the map
+            //reports as changed (map::minimap_cache_is_dirty) are recolored
+            bool complete = false;
             //the texture updates are drawn to
             SDL_Texture_Ptr chunk_tex;
             //the submap being handled
@@ -115,6 +118,8 @@ class pixel_minimap
 
         //track the previous viewing area to determine if the minimap cache needs to be cleared
         tripoint_abs_sm cached_center_sm;
+        //night vision changes the color of every lit tile without the map noticing
+        bool cached_nv_goggle = false;
 
         SDL_Rect screen_rect;
         SDL_Rect main_tex_clip_rect;
@@ -0,0 +1 @@
+#define PREFIX "/usr/local"
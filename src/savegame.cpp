@@ -149,16 +149,14 @@ void game::serialize_json( std::ostream &fout )
                  inactive_global_effect_on_condition_vector );
 
     //save queued effect_on_conditions
-    queued_eocs temp_queued( queued_global_effect_on_conditions );
     json.member( "queued_global_effect_on_conditions" );
     json.start_array();
-    while( !temp_queued.empty() ) {
+    for( const queued_eoc &queued : queued_global_effect_on_conditions.list ) {
         json.start_object();
-        json.member( "time", temp_queued.top().time );
-        json.member( "eoc", temp_queued.top().eoc );
-        json.member( "context", temp_queued.top().context );
+        json.member( "time", queued.time );
+        json.member( "eoc", queued.eoc );
+        json.member( "context", queued.context );
         json.end_object();
-        temp_queued.pop();
     }
     json.end_array();
     global_variables_instance.serialize( json );
@@ -2013,7 +2011,7 @@ void timed_event_manager::serialize_all( JsonOut &jsout )
                     jsout.member( "furn", elem.revert.get_furn( pt ) );
                     jsout.member( "ter", elem.revert.get_ter( pt ) );
                     jsout.member( "trap", elem.revert.get_trap( pt ) );
-                    jsout.member( "items", elem.revert.get_items( pt ) );
+                    jsout.member( "items", elem.revert.read_items( pt ) );
                     jsout.end_object();
                 }
             }
@@ -1582,16 +1582,14 @@ void Character::store( JsonOut &json ) const
     json.member( "suppress_autohaul", suppress_autohaul );
 
     //save queued effect_on_conditions
-    queued_eocs temp_queued( queued_effect_on_conditions );
     json.member( "queued_effect_on_conditions" );
     json.start_array();
-    while( !temp_queued.empty() ) {
+    for( const queued_eoc &queued : queued_effect_on_conditions.list ) {
         json.start_object();
-        json.member( "time", temp_queued.top().time );
-        json.member( "eoc", temp_queued.top().eoc );
-        json.member( "context", temp_queued.top().context );
+        json.member( "time", queued.time );
+        json.member( "eoc", queued.eoc );
+        json.member( "context", queued.context );
         json.end_object();
-        temp_queued.pop();
     }
 
     json.end_array();
@@ -4443,7 +4441,19 @@ void player_morale::load( const JsonObject &jsin )
     jsin.read( "morale", points );
 }
 
-void mm_submap::serialize( JsonOut &jsout ) const
+// Rotation and subtile are both int8_t, saved together as one number.
+static int pack_memorized_bits( int8_t subtile, int8_t rotation )
+{
+    return ( static_cast<uint8_t>( subtile ) << 8 ) | static_cast<uint8_t>( rotation );
+}
+
+static void unpack_memorized_bits( int packed, int8_t &subtile, int8_t &rotation )
+{
+    subtile = static_cast<int8_t>( static_cast<uint8_t>( packed >> 8 ) );
+    rotation = static_cast<int8_t>( static_cast<uint8_t>( packed ) );
+}
+
+void mm_submap::serialize( JsonOut &jsout, mm_palette &palette ) const
 {
     jsout.start_array();
 
@@ -4456,13 +4466,11 @@ void mm_submap::serialize( JsonOut &jsout ) const
         jsout.start_array();
         jsout.write( num_same );
         jsout.write( static_cast<int>( last.symbol ) );
-        jsout.write( last.ter_id );
-        jsout.write( static_cast<int>( last.ter_subtile ) );
-        jsout.write( static_cast<int>( last.ter_rotation ) );
-        if( !last.get_dec_id().empty() ) {
-            jsout.write( last.dec_id );
-            jsout.write( static_cast<int>( last.dec_subtile ) );
-            jsout.write( static_cast<int>( last.dec_rotation ) );
+        jsout.write( palette.index_of( last.ter_id ) );
+        jsout.write( pack_memorized_bits( last.ter_subtile, last.ter_rotation ) );
+        if( last.dec_id != 0 ) {
+            jsout.write( palette.index_of( last.dec_id ) );
+            jsout.write( pack_memorized_bits( last.dec_subtile, last.dec_rotation ) );
         }
         jsout.end_array();
     };
@@ -4496,7 +4504,7 @@ static std::string migrate_memorized_terrain( const std::string &ter_id )
     return ter_id;
 }
 
-void mm_submap::deserialize( int version, const JsonArray &ja )
+void mm_submap::deserialize( int version, const JsonArray &ja, const mm_palette &palette )
 {
     size_t submap_array_idx = 0;
 
@@ -4504,6 +4512,14 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
     memorized_tile tile;
     size_t remaining = 0;
 
+    const auto palette_id = [&ja]( const std::vector<uint32_t> &ids, int index ) -> uint32_t {
+        if( index < 0 || static_cast<size_t>( index ) >= ids.size() )
+        {
+            ja.throw_error( string_format( "memorized tile id index %d out of range", index ) );
+        }
+        return ids[index];
+    };
+
     for( size_t y = 0; y < SEEY; y++ ) {
         for( size_t x = 0; x < SEEX; x++ ) {
             if( remaining > 0 ) {
@@ -4523,10 +4539,10 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                         tile.set_ter_id( "" );
                         tile.set_ter_subtile( 0 );
                         tile.set_ter_rotation( 0 );
-                        tile.set_dec_id( std::move( id ) );
+                        tile.set_dec_id( id );
                         tile.set_dec_subtile( ja_tile.get_int( 1 ) );
                         const int legacy_rotation = ja_tile.get_int( 2 );
-                        if( string_starts_with( tile.dec_id, "vp_" ) ) {
+                        if( string_starts_with( id, "vp_" ) ) {
                             // legacy vehicle rotation needs to be converted from 0-360 degrees
                             // to 0-3 tileset rotation
                             const units::angle legacy_angle = units::from_degrees( legacy_rotation );
@@ -4539,7 +4555,7 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                     if( ja_tile.size() > 4 ) {
                         remaining = ja_tile.get_int( 4 ) - 1;
                     }
-                } else {
+                } else if( version < 2 ) { // string ids, no palette
                     remaining = ja_tile.get_int( 0 ) - 1;
                     tile.symbol = ja_tile.get_int( 1 );
                     tile.set_ter_id( migrate_memorized_terrain( ja_tile.get_string( 2 ) ) );
@@ -4554,6 +4570,19 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                         tile.dec_subtile = 0;
                         tile.dec_rotation = 0;
                     }
+                } else {
+                    remaining = ja_tile.get_int( 0 ) - 1;
+                    tile.symbol = ja_tile.get_int( 1 );
+                    tile.ter_id = palette_id( palette.ter_ids, ja_tile.get_int( 2 ) );
+                    unpack_memorized_bits( ja_tile.get_int( 3 ), tile.ter_subtile, tile.ter_rotation );
+                    if( ja_tile.size() > 4 ) {
+                        tile.dec_id = palette_id( palette.dec_ids, ja_tile.get_int( 4 ) );
+                        unpack_memorized_bits( ja_tile.get_int( 5 ), tile.dec_subtile, tile.dec_rotation );
+                    } else {
+                        tile.dec_id = 0;
+                        tile.dec_subtile = 0;
+                        tile.dec_rotation = 0;
+                    }
                 }
             }
             // Try to avoid assigning to save up on memory
@@ -4566,8 +4595,12 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
 
 void mm_region::serialize( JsonOut &jsout ) const
 {
+    // Version 2 writes each id once into the region's "ids" palette, tiles
+    // refer to it by index. Older versions are still read and get rewritten
+    // in this format the next time the region is saved.
+    mm_palette palette;
     jsout.start_object();
-    jsout.member( "version", 1 );
+    jsout.member( "version", 2 );
     jsout.write( "data" );
     jsout.write_member_separator();
     jsout.start_array();
@@ -4578,11 +4611,17 @@ void mm_region::serialize( JsonOut &jsout ) const
             if( sm->is_empty() ) {
                 jsout.write_null();
             } else {
-                sm->serialize( jsout );
+                sm->serialize( jsout, palette );
             }
         }
     }
     jsout.end_array();
+    jsout.member( "ids" );
+    jsout.start_array();
+    for( const uint32_t id : palette.ids ) {
+        jsout.write( memorized_tile::pooled_id( id ) );
+    }
+    jsout.end_array();
     jsout.end_object();
 }
 
@@ -4590,6 +4629,7 @@ void mm_region::deserialize( const JsonValue &ja )
 {
     int version;
     JsonArray region_json;
+    mm_palette palette;
 
     if( ja.test_array() ) { // legacy, remove after 0.H comes out
         version = 0;
@@ -4598,6 +4638,12 @@ void mm_region::deserialize( const JsonValue &ja )
         JsonObject region_obj = ja;
         version = region_obj.get_int( "version" );
         region_json = region_obj.get_array( "data" );
+        if( version >= 2 ) {
+            for( const std::string id : region_obj.get_array( "ids" ) ) {
+                palette.ter_ids.push_back( memorized_tile::intern_id( migrate_memorized_terrain( id ) ) );
+                palette.dec_ids.push_back( memorized_tile::intern_id( id ) );
+            }
+        }
     }
 
     for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
@@ -4607,7 +4653,7 @@ void mm_region::deserialize( const JsonValue &ja )
             sm = make_shared_fast<mm_submap>();
             const JsonValue jsin = region_json.next_value();
             if( !jsin.test_null() ) {
-                sm->deserialize( version, jsin );
+                sm->deserialize( version, jsin, palette );
             }
         }
     }
@@ -5510,26 +5556,26 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
                     const ter_str_id tid( terrain_json.next_string() );
 
                     if( tid == ter_t_rubble ) {
-                        m->ter[i][j] = ter_t_dirt;
-                        m->frn[i][j] = furn_id( "f_rubble" );
-                        m->itm[i][j].insert( rock );
-                        m->itm[i][j].insert( rock );
+                        m->ter.get_mutable( i )[j] = ter_t_dirt;
+                        m->frn.get_mutable( i )[j] = furn_id( "f_rubble" );
+                        m->itm.get_mutable( i )[j].insert( rock );
+                        m->itm.get_mutable( i )[j].insert( rock );
                     } else if( tid == ter_t_wreckage ) {
-                        m->ter[i][j] = ter_t_dirt;
-                        m->frn[i][j] = furn_id( "f_wreckage" );
-                        m->itm[i][j].insert( chunk );
-                        m->itm[i][j].insert( chunk );
+                        m->ter.get_mutable( i )[j] = ter_t_dirt;
+                        m->frn.get_mutable( i )[j] = furn_id( "f_wreckage" );
+                        m->itm.get_mutable( i )[j].insert( chunk );
+                        m->itm.get_mutable( i )[j].insert( chunk );
                     } else if( tid == ter_t_ash ) {
-                        m->ter[i][j] = ter_t_dirt;
-                        m->frn[i][j] = furn_id( "f_ash" );
+                        m->ter.get_mutable( i )[j] = ter_t_dirt;
+                        m->frn.get_mutable( i )[j] = furn_id( "f_ash" );
                     } else if( tid == ter_t_pwr_sb_support_l ) {
-                        m->ter[i][j] = ter_t_support_l;
+                        m->ter.get_mutable( i )[j] = ter_t_support_l;
                     } else if( tid == ter_t_pwr_sb_switchgear_l ) {
-                        m->ter[i][j] = ter_t_switchgear_l;
+                        m->ter.get_mutable( i )[j] = ter_t_switchgear_l;
                     } else if( tid == ter_t_pwr_sb_switchgear_s ) {
-                        m->ter[i][j] = ter_t_switchgear_s;
+                        m->ter.get_mutable( i )[j] = ter_t_switchgear_s;
                     } else {
-                        m->ter[i][j] = tid.id();
+                        m->ter.get_mutable( i )[j] = tid.id();
                     }
                 }
             }
@@ -5572,9 +5618,9 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
                     } else {
                         --remaining;
                     }
-                    m->ter[i][j] = iid_ter;
+                    m->ter.get_mutable( i )[j] = iid_ter;
                     if( iid_furn ) {
-                        m->frn[i][j] = iid_furn;
+                        m->frn.get_mutable( i )[j] = iid_furn;
                     }
                 }
             }
@@ -5606,7 +5652,7 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
             if( auto it = furn_migrations.find( furnstr ); it != furn_migrations.end() ) {
                 furnstr = it->second.second;
                 if( it->second.first != ter_str_id::NULL_ID() ) {
-                    m->ter[i][j] = it->second.first.id();
+                    m->ter.get_mutable( i )[j] = it->second.first.id();
                 }
             }
             if( furnstr.is_valid() ) {
@@ -5615,7 +5661,7 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
                 debugmsg( "invalid furn_str_id '%s'", furnstr.c_str() );
                 iid_furn = furn_str_id::NULL_ID().id();
             }
-            m->frn[i][j] = iid_furn;
+            m->frn.get_mutable( i )[j] = iid_furn;
             if( furniture_entry.size() > 3 ) {
                 furniture_entry.throw_error( "Too many values for furniture entry." );
             }
@@ -5627,11 +5673,12 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
             int j = items_json.next_int();
             const point_sm_ms p( i, j );
 
-            if( !items_json.next_value().read( m->itm[p.x()][p.y()], false ) ) {
+            cata::colony<item> &items = m->itm.get_mutable( p.x() )[p.y()];
+            if( !items_json.next_value().read( items, false ) ) {
                 debugmsg( "Items array is corrupt in submap at: %s, skipping", p.to_string() );
             }
             // some portion could've been read even if error occurred
-            for( item &it : m->itm[p.x()][p.y()] ) {
+            for( item &it : items ) {
                 if( it.is_emissive() ) {
                     update_lum_add( p, it );
                 }
@@ -5646,7 +5693,7 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
             const point_sm_ms p( i, j );
             // TODO: jsin should support returning an id like jsin.get_id<trap>()
             const trap_str_id trid( trap_entry.next_string() );
-            m->trp[p.x()][p.y()] = trid.id();
+            m->trp.get_mutable( p.x() )[p.y()] = trid.id();
             if( trap_entry.has_more() ) {
                 std::optional<std::string> trap_item_type = std::nullopt;
                 trap_entry.read_next( trap_item_type );
@@ -5683,8 +5730,10 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
                     if( !ft.is_valid() ) {
                         debugmsg( "invalid field_type_str_id '%s'", ft.c_str() );
                     } else if( ft != field_type_str_id::NULL_ID() &&
-                               m->fld[i][j].add_field( ft.id(), intensity, time_duration::from_turns( age ), source ) ) {
+                               m->fld.get_mutable( i )[j].add_field( ft.id(), intensity,
+                                       time_duration::from_turns( age ), source ) ) {
                         field_count++;
+                        set_field_tile( { i, j }, true );
                     }
                 }
             }
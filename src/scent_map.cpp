@@ -14,8 +14,6 @@
 #include "output.h"
 #include "point.h"
 
-static constexpr int SCENT_RADIUS = 40;
-
 static nc_color sev( const size_t level )
 {
     static const std::array<nc_color, 22> colors = { {
@@ -177,92 +175,87 @@ void scent_map::update( const tripoint_bub_ms &center, map &m )
         return;
     }
 
-    // note: the next four intermediate matrices need to be at least
-    // [2*SCENT_RADIUS+3][2*SCENT_RADIUS+1] in size to hold enough data
-    // The code I'm modifying used [MAPSIZE_X]. I'm staying with that to avoid new bugs.
-
-    // These two matrices are transposed so that x addresses are contiguous in memory
-    scent_array<int> sum_3_scent_y;
-    scent_array<int> squares_used_y;
+    m.scent_blockers( scent_weight,
+                      point_bub_ms( center.x() - SCENT_RADIUS - 1, center.y() - SCENT_RADIUS - 1 ),
+                      point_bub_ms( center.x() + SCENT_RADIUS + 1, center.y() + SCENT_RADIUS + 1 ) );
+    diffuse( grscent, scent_weight, center.xy(), buffers );
+}
 
-    // these are for caching flag lookups
-    scent_array<bool> blocks_scent; // currently only ter_furn_flag::TFLAG_NO_SCENT blocks scent
-    scent_array<bool> reduces_scent;
+void scent_map::diffuse( scent_array<int> &scent, const scent_array<int> &weight,
+                         const point_bub_ms &center, diffusion_buffers &buffers )
+{
+    using column = diffusion_buffers::column;
+    static constexpr int radius = SCENT_RADIUS;
+    static constexpr int rows = diffusion_buffers::rows;
 
     // for loop constants
-    const int scentmap_minx = center.x() - SCENT_RADIUS;
-    const int scentmap_maxx = center.x() + SCENT_RADIUS;
-    const int scentmap_miny = center.y() - SCENT_RADIUS;
-    const int scentmap_maxy = center.y() + SCENT_RADIUS;
+    const int scentmap_minx = center.x() - radius;
+    const int scentmap_maxx = center.x() + radius;
+    const int scentmap_miny = center.y() - radius;
+    const int scentmap_maxy = center.y() + radius;
 
     // decrease this to reduce gas spread. Keep it under 125 for
     // stability. This is essentially a decimal number * 1000.
-    const int diffusivity = 100;
+    static constexpr int diffusivity = 100;
+    static_assert( diffusivity % 10 == 0, "diffusivity is scaled by weight / 10" );
+
+    // The inner loops only touch the buffers, so nothing they read may alias what they
+    // write, and they run a fixed number of rows, so no scalar epilogue is needed. That
+    // is what lets GCC vectorize them at -O2. The few rows past the window are computed
+    // too, but never copied back. Column index y + 1 holds map row y.
 
-    // The new scent flag searching function. Should be wayyy faster than the old one.
-    m.scent_blockers( blocks_scent, reduces_scent, point_bub_ms( scentmap_minx - 1, scentmap_miny - 1 ),
-                      point_bub_ms( scentmap_maxx + 1, scentmap_maxy + 1 ) );
     // Sum neighbors in the y direction.  This way, each square gets called 3 times instead of 9
-    // times. This cost us an extra loop here, but it also eliminated a loop at the end, so there
-    // is a net performance improvement over the old code. Could probably still be better.
+    // times.
     // note: this method needs an array that is one square larger on each side in the x direction
     // than the final scent matrix. I think this is fine since SCENT_RADIUS is less than
     // MAPSIZE_X, but if that changes, this may need tweaking.
     for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
-        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
+        column &s = buffers.scent[x];
+        column &w = buffers.weight[x];
+        std::copy( scent[x].begin(), scent[x].end(), s.begin() + 1 );
+        std::copy( weight[x].begin(), weight[x].end(), w.begin() + 1 );
+        column &sum = buffers.sum_3_scent_y[x];
+        column &used = buffers.squares_used_y[x];
+        for( int y = scentmap_miny + 1; y < scentmap_miny + 1 + rows; ++y ) {
             // remember the sum of the scent val for the 3 neighboring squares that can defuse into
-            sum_3_scent_y[y][x] = 0;
-            squares_used_y[y][x] = 0;
-            for( int i = y - 1; i <= y + 1; ++i ) {
-                if( !blocks_scent[x][i] ) {
-                    if( reduces_scent[x][i] ) {
-                        // only 20% of scent can diffuse on REDUCE_SCENT squares
-                        sum_3_scent_y[y][x] += 2 * grscent[x][i];
-                        squares_used_y[y][x] += 2;
-                    } else {
-                        sum_3_scent_y[y][x] += 10 * grscent[x][i];
-                        squares_used_y[y][x] += 10;
-                    }
-                }
-            }
+            sum[y] = w[y - 1] * s[y - 1] + w[y] * s[y] + w[y + 1] * s[y + 1];
+            used[y] = w[y - 1] + w[y] + w[y + 1];
         }
     }
 
     // Rest of the scent map
+    column next{};
     for( int x = scentmap_minx; x <= scentmap_maxx; ++x ) {
-        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
-            int &scent_here = grscent[x][y];
-            if( !blocks_scent[x][y] ) {
-                // to how many neighboring squares do we diffuse out? (include our own square
-                // since we also include our own square when diffusing in)
-                const int squares_used = squares_used_y[y][x - 1]
-                                         + squares_used_y[y][x]
-                                         + squares_used_y[y][x + 1];
-
-                int this_diffusivity;
-                if( !reduces_scent[x][y] ) {
-                    this_diffusivity = diffusivity;
-                } else {
-                    this_diffusivity = diffusivity / 5; //less air movement for REDUCE_SCENT square
-                }
-                // take the old scent and subtract what diffuses out
-                int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
-                // neighboring REDUCE_SCENT squares absorb some scent
-                temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
-                // we've already summed neighboring scent values in the y direction in the previous
-                // loop. Now we do it for the x direction, multiply by diffusion, and this is what
-                // diffuses into our current square.
-                scent_here =
-                    ( temp_scent
-                      + this_diffusivity * ( sum_3_scent_y[y][x - 1]
-                                             + sum_3_scent_y[y][x]
-                                             + sum_3_scent_y[y][x + 1] )
-                    ) / ( 1000 * 10 );
-            } else {
-                // this cell blocks scent via NO_SCENT (in json)
-                scent_here = 0;
-            }
+        const column &s = buffers.scent[x];
+        const column &w = buffers.weight[x];
+        const column &sum_l = buffers.sum_3_scent_y[x - 1];
+        const column &sum_c = buffers.sum_3_scent_y[x];
+        const column &sum_r = buffers.sum_3_scent_y[x + 1];
+        const column &used_l = buffers.squares_used_y[x - 1];
+        const column &used_c = buffers.squares_used_y[x];
+        const column &used_r = buffers.squares_used_y[x + 1];
+        for( int y = scentmap_miny + 1; y < scentmap_miny + 1 + rows; ++y ) {
+            const int scent_here = s[y];
+            // to how many neighboring squares do we diffuse out? (include our own square
+            // since we also include our own square when diffusing in)
+            const int squares_used = used_l[y] + used_c[y] + used_r[y];
+            // less air movement for REDUCE_SCENT square
+            const int this_diffusivity = w[y] * ( diffusivity / 10 );
+            // take the old scent and subtract what diffuses out
+            int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
+            // neighboring REDUCE_SCENT squares absorb some scent
+            temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
+            // we've already summed neighboring scent values in the y direction in the previous
+            // loop. Now we do it for the x direction, multiply by diffusion, and this is what
+            // diffuses into our current square.
+            const int diffused =
+                ( temp_scent + this_diffusivity * ( sum_l[y] + sum_c[y] + sum_r[y] ) )
+                / ( 1000 * 10 );
+            // cells that block scent via NO_SCENT (in json) hold none
+            next[y] = w[y] != weight_blocked ? diffused : 0;
         }
+        std::copy( next.begin() + 1 + scentmap_miny, next.begin() + 2 + scentmap_maxy,
+                   scent[x].begin() + scentmap_miny );
     }
 }
 
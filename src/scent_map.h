@@ -19,6 +19,8 @@
 class JsonObject;
 
 constexpr int SCENT_MAP_Z_REACH = 1;
+// Scent diffuses over the cells within this distance of the player.
+constexpr int SCENT_RADIUS = 40;
 
 class game;
 class map;
@@ -46,14 +48,38 @@ class scent_type
 
 class scent_map
 {
-    protected:
+    public:
         template<typename T>
         using scent_array = std::array<std::array<T, MAPSIZE_Y>, MAPSIZE_X>;
 
+        // Share of a cell's scent that takes part in diffusion, in tenths.
+        static constexpr int weight_blocked = 0; // NO_SCENT
+        static constexpr int weight_reduced = 2; // REDUCE_SCENT
+        static constexpr int weight_open = 10;
+
+        /**
+         * Scratch space for @ref diffuse, holding copies of the map columns with one
+         * padding cell before them and enough after them for the rounding of `rows`.
+         */
+        struct diffusion_buffers {
+            // Rows diffuse computes per column: the window rounded up to a multiple of 8,
+            // a fixed trip count every vector width divides.
+            static constexpr int rows = ( 2 * SCENT_RADIUS + 1 + 7 ) / 8 * 8;
+            using column = std::array < int, MAPSIZE_Y + 2 + rows - ( 2 * SCENT_RADIUS + 1 ) >;
+            std::array<column, MAPSIZE_X> scent{};
+            std::array<column, MAPSIZE_X> weight{};
+            std::array<column, MAPSIZE_X> sum_3_scent_y{};
+            std::array<column, MAPSIZE_X> squares_used_y{};
+        };
+
+    protected:
         scent_array<int> grscent;
         scenttype_id typescent;
         std::optional<tripoint_bub_ms> player_last_position; // NOLINT(cata-serialize)
         time_point player_last_moved = calendar::before_time_starts; // NOLINT(cata-serialize)
+        // Reused by every update instead of being rebuilt on the stack each turn.
+        scent_array<int> scent_weight = {}; // NOLINT(cata-serialize)
+        diffusion_buffers buffers; // NOLINT(cata-serialize)
 
         const game &gm; // NOLINT(cata-serialize)
 
@@ -66,6 +92,13 @@ class scent_map
         void draw( const catacurses::window &win, int div, const tripoint_bub_ms &center ) const;
 
         void update( const tripoint_bub_ms &center, map &m );
+        /**
+         * One step of scent diffusion over the cells within SCENT_RADIUS of @p center.
+         * @p weight holds weight_blocked, weight_reduced or weight_open per cell and
+         * must be filled one cell further out.
+         */
+        static void diffuse( scent_array<int> &scent, const scent_array<int> &weight,
+                             const point_bub_ms &center, diffusion_buffers &buffers );
         void reset();
         void decay();
         void shift( const point_rel_ms &sm_shift );
@@ -1,6 +1,9 @@
 ﻿#if defined( TILES )
 #include "sdl_font.h"
 
+#include <algorithm>
+
+#include "catacharset.h"
 #include "font_loader.h"
 #include "output.h"
 #include "sdl_utils.h"
@@ -302,14 +305,12 @@ CachedTTFFont::CachedTTFFont(
     SetFontStyle( font, TTF_STYLE_NORMAL );
 }
 
-SDL_Texture_Ptr CachedTTFFont::create_glyph( const SDL_Renderer_Ptr &renderer,
-        const std::string &ch,
-        int &ch_width,
-        const int color )
+SDL_Surface_Ptr CachedTTFFont::render_glyph( const std::string &ch, int &ch_width ) const
 {
+    constexpr SDL_Color white = { 255, 255, 255, 255 };
     SDL_Surface_Ptr sglyph = fontblending
-                             ? RenderUTF8_Blended( font, ch.c_str(), windowsPalette[color] )
-                             : RenderUTF8_Solid( font, ch.c_str(), windowsPalette[color] );
+                             ? RenderUTF8_Blended( font, ch.c_str(), white )
+                             : RenderUTF8_Solid( font, ch.c_str(), white );
     if( !sglyph ) {
         dbg( D_ERROR ) << "Failed to create glyph for " << ch << ": " << SDL_GetError();
         return nullptr;
@@ -342,9 +343,98 @@ SDL_Texture_Ptr CachedTTFFont::create_glyph( const SDL_Renderer_Ptr &renderer,
                        "SDL_BlitSurface failed" ) ) {
         sglyph = std::move( surface );
     }
-    SetSurfaceBlendMode( sglyph, SDL_BLENDMODE_BLEND );
+    // The atlas is uploaded to directly, so it needs the pixels in its own format.
+    if( GetSurfacePixelFormat( sglyph ) != SDL_PIXELFORMAT_RGBA32 ) {
+        sglyph = ConvertSurfaceFormat( sglyph, SDL_PIXELFORMAT_RGBA32 );
+    }
+    return sglyph;
+}
+
+CachedTTFFont::glyph_slot CachedTTFFont::rasterize( const SDL_Renderer_Ptr &renderer,
+        const std::string &ch )
+{
+    glyph_slot slot;
+    int ch_width = 0;
+    const SDL_Surface_Ptr surface = render_glyph( ch, ch_width );
+    if( !surface ) {
+        return slot;
+    }
+
+    std::optional<point> corner;
+    if( !atlas_pages.empty() ) {
+        corner = atlas_pages.back().packer.insert( surface->w, surface->h );
+    }
+    if( !corner ) {
+        // Big enough for a few thousand glyphs of a usual terminal font, so most
+        // games never need a second page.
+        int page_size = 1024;
+        int max_w = 0;
+        int max_h = 0;
+        if( GetRendererMaxTextureSize( renderer, &max_w, &max_h ) && max_w > 0 && max_h > 0 ) {
+            page_size = std::min( { page_size, max_w, max_h } );
+        }
+        atlas_page page{ CreateTexture( renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC,
+                                        page_size, page_size ), shelf_packer( page_size, page_size ) };
+        if( !page.texture ) {
+            return slot;
+        }
+        SetTextureBlendMode( page.texture, SDL_BLENDMODE_BLEND );
+        corner = page.packer.insert( surface->w, surface->h );
+        if( !corner ) {
+            dbg( D_ERROR ) << "Glyph " << ch << " does not fit into an atlas page";
+            return slot;
+        }
+        atlas_pages.emplace_back( std::move( page ) );
+    }
+
+    const SDL_Rect rect = { corner->x, corner->y, surface->w, surface->h };
+    if( printErrorIf( !SDL_UpdateTexture( atlas_pages.back().texture.get(), &rect, surface->pixels,
+                                          surface->pitch ), "SDL_UpdateTexture failed" ) ) {
+        return slot;
+    }
+    slot.page = static_cast<int>( atlas_pages.size() ) - 1;
+    slot.rect = rect;
+    return slot;
+}
 
-    return CreateTextureFromSurface( renderer, sglyph );
+namespace
+{
+// The codepoint @p ch consists of, if it is exactly one valid one.
+std::optional<uint32_t> single_codepoint( const std::string &ch )
+{
+    const char *str = ch.c_str();
+    int len = static_cast<int>( ch.length() );
+    const uint32_t codepoint = UTF8_getch( &str, &len );
+    if( len != 0 || codepoint == UNKNOWN_UNICODE ) {
+        return std::nullopt;
+    }
+    return codepoint;
+}
+} // namespace
+
+const CachedTTFFont::glyph_slot &CachedTTFFont::slot_for( const SDL_Renderer_Ptr &renderer,
+        const std::string &ch )
+{
+    const std::optional<uint32_t> codepoint = single_codepoint( ch );
+    if( !codepoint ) {
+        auto it = cluster_slots.find( ch );
+        if( it == cluster_slots.end() ) {
+            it = cluster_slots.emplace( ch, rasterize( renderer, ch ) ).first;
+        }
+        return it->second;
+    }
+    if( *codepoint < ascii_slots.size() ) {
+        std::optional<glyph_slot> &slot = ascii_slots[*codepoint];
+        if( !slot ) {
+            slot = rasterize( renderer, ch );
+        }
+        return *slot;
+    }
+    auto it = codepoint_slots.find( *codepoint );
+    if( it == codepoint_slots.end() ) {
+        it = codepoint_slots.emplace( *codepoint, rasterize( renderer, ch ) ).first;
+    }
+    return it->second;
 }
 
 bool CachedTTFFont::isGlyphProvided( const std::string &ch ) const
@@ -360,32 +450,21 @@ bool CachedTTFFont::isGlyphProvided( const std::string &ch ) const
     return static_cast<bool>( surface );
 }
 
-void CachedTTFFont::OutputChar( const SDL_Renderer_Ptr &renderer, const GeometryRenderer_Ptr &,
+void CachedTTFFont::OutputChar( const SDL_Renderer_Ptr &renderer,
+                                const GeometryRenderer_Ptr &geometry,
                                 const std::string &ch, const point &p,
                                 unsigned char color, const float opacity )
 {
-    key_t    key {ch, static_cast<unsigned char>( color & 0xf )};
-
-    auto it = glyph_cache_map.find( key );
-    if( it == std::end( glyph_cache_map ) ) {
-        cached_t new_entry;
-        new_entry.texture = create_glyph( renderer, key.codepoints, new_entry.width, key.color );
-        it = glyph_cache_map.insert( std::make_pair( std::move( key ), std::move( new_entry ) ) ).first;
-    }
-    const cached_t &value = it->second;
-
-    if( !value.texture ) {
+    const glyph_slot &slot = slot_for( renderer, ch );
+    if( slot.page < 0 ) {
         // Nothing we can do here )-:
         return;
     }
-    SDL_Rect rect {p.x, p.y, value.width, height};
-    if( opacity != 1.0f ) {
-        SetTextureAlphaMod( value.texture, opacity * 255.0f );
-    }
-    RenderCopy( renderer, value.texture, nullptr, &rect );
-    if( opacity != 1.0f ) {
-        SetTextureAlphaMod( value.texture, 255 );
-    }
+    const SDL_Color &c = windowsPalette[color & 0xf];
+    const SDL_FColor tint = { c.r / 255.0f, c.g / 255.0f, c.b / 255.0f, c.a / 255.0f * opacity };
+    const SDL_Rect rect { p.x, p.y, slot.rect.w, slot.rect.h };
+    // Consecutive glyphs from the same page end up in one SDL_RenderGeometry call.
+    geometry->tinted_sprite( renderer, atlas_pages[slot.page].texture.get(), slot.rect, rect, tint );
 }
 
 BitmapFont::BitmapFont(
@@ -614,26 +693,53 @@ bool FontFallbackList::isGlyphProvided( const std::string & ) const
     return true;
 }
 
+size_t FontFallbackList::font_for( const std::string &ch )
+{
+    const auto find = [&]() {
+        for( size_t i = 0; i + 1 < fonts.size(); ++i ) {
+            if( fonts[i]->isGlyphProvided( ch ) ) {
+                return i;
+            }
+        }
+        return fonts.size() - 1;
+    };
+    const std::optional<uint32_t> codepoint = single_codepoint( ch );
+    if( !codepoint ) {
+        auto it = cluster_font.find( ch );
+        if( it == cluster_font.end() ) {
+            it = cluster_font.emplace( ch, find() ).first;
+        }
+        return it->second;
+    }
+    if( *codepoint < ascii_font.size() ) {
+        std::optional<size_t> &index = ascii_font[*codepoint];
+        if( !index ) {
+            index = find();
+        }
+        return *index;
+    }
+    auto it = codepoint_font.find( *codepoint );
+    if( it == codepoint_font.end() ) {
+        it = codepoint_font.emplace( *codepoint, find() ).first;
+    }
+    return it->second;
+}
+
 void FontFallbackList::OutputChar( const SDL_Renderer_Ptr &renderer,
                                    const GeometryRenderer_Ptr &geometry,
                                    const std::string &ch, const point &p,
                                    unsigned char color, const float opacity )
 {
-    auto cached = glyph_font.find( ch );
-    if( cached == glyph_font.end() ) {
-        for( auto it = fonts.begin(); it != fonts.end(); ++it ) {
-            if( std::next( it ) == fonts.end() || ( *it )->isGlyphProvided( ch ) ) {
-                cached = glyph_font.emplace( ch, it ).first;
-                break;
-            }
-        }
-    }
-    ( *cached->second )->OutputChar( renderer, geometry, ch, p, color, opacity );
+    fonts[font_for( ch )]->OutputChar( renderer, geometry, ch, p, color, opacity );
 }
 
 void CachedTTFFont::release_gpu_resources()
 {
-    glyph_cache_map.clear();
+    // Every slot points into a page, so they all go together.
+    atlas_pages.clear();
+    ascii_slots.fill( std::nullopt );
+    codepoint_slots.clear();
+    cluster_slots.clear();
 }
 
 void BitmapFont::release_gpu_resources()
@@ -9,18 +9,20 @@
 #include "sdltiles.h" // IWYU pragma: associated
 
 #include <array>
-#include <map>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 #include "sdl_geometry.h"
 #include "color.h"
 #include "color_loader.h"
 #include "debug.h"
 #include "point.h"
-#include "hash_utils.h"
 #include "sdl_wrappers.h"
+#include "shelf_packer.h"
 
 using palette_array = std::array<SDL_Color, color_loader<SDL_Color>::COLOR_NAMES_COUNT>;
 
@@ -81,7 +83,9 @@ class Font
 };
 using Font_Ptr = std::unique_ptr<Font>;
 
-/// Font implementation on a TrueType font. Its glyphs are cached.
+/// Font implementation on a TrueType font. Its glyphs are rasterized on first
+/// use into shared atlas textures, so that text drawn with one font can be
+/// batched into a few geometry calls whatever its colors.
 class CachedTTFFont : public Font
 {
     public:
@@ -99,37 +103,33 @@ class CachedTTFFont : public Font
         void release_gpu_resources() override;
 
     protected:
-        SDL_Texture_Ptr create_glyph( const SDL_Renderer_Ptr &renderer, const std::string &ch,
-                                      int &ch_width, int color );
+        /// Renders @p ch in white, centered in a surface the size of the cells it covers.
+        SDL_Surface_Ptr render_glyph( const std::string &ch, int &ch_width ) const;
 
         TTF_Font_Ptr font;
-        // Maps (character code, color) to SDL_Texture*
 
-        struct key_t {
-            std::string   codepoints;
-            unsigned char color;
-
-            std::pair<std::string, unsigned char> as_pair() const {
-                return std::make_pair( codepoints, color );
-            }
-
-            friend bool operator==( const key_t &lhs, const key_t &rhs ) noexcept {
-                return lhs.as_pair() == rhs.as_pair();
-            }
-        };
-
-        struct key_t_hash {
-            size_t operator()( const key_t &k ) const {
-                return cata::auto_hash<std::pair<std::string, unsigned char>>()( k.as_pair() );
-            }
+        /// Where a glyph is in the atlas. Every glyph is rasterized once, in white,
+        /// and drawn in any color by tinting its vertices.
+        struct glyph_slot {
+            // Index into atlas_pages, or -1 if the glyph could not be rendered.
+            int page = -1;
+            SDL_Rect rect = { 0, 0, 0, 0 };
         };
-
-        struct cached_t {
+        struct atlas_page {
             SDL_Texture_Ptr texture;
-            int          width;
+            shelf_packer packer;
         };
 
-        std::unordered_map<key_t, cached_t, key_t_hash> glyph_cache_map;
+        /// @returns the slot of @p ch, rasterizing it into the atlas on first use.
+        const glyph_slot &slot_for( const SDL_Renderer_Ptr &renderer, const std::string &ch );
+        glyph_slot rasterize( const SDL_Renderer_Ptr &renderer, const std::string &ch );
+
+        std::vector<atlas_page> atlas_pages;
+        // Most text is ASCII, which is looked up without hashing at all.
+        std::array<std::optional<glyph_slot>, 128> ascii_slots;
+        std::unordered_map<uint32_t, glyph_slot> codepoint_slots;
+        // Anything that is not a single valid codepoint, like a base letter with combining marks.
+        std::unordered_map<std::string, glyph_slot> cluster_slots;
 
         const bool fontblending;
 };
@@ -191,8 +191,14 @@ class FontFallbackList : public Font
         void release_gpu_resources() override;
         void rebuild_for_renderer( const SDL_Renderer_Ptr &renderer ) override;
     protected:
+        /// @returns index into fonts of the first font that provides @p ch.
+        size_t font_for( const std::string &ch );
+
         std::vector<std::unique_ptr<Font>> fonts;
-        std::map<std::string, std::vector<std::unique_ptr<Font>>::iterator> glyph_font;
+        // Which font draws a glyph, keyed like the glyph slots of CachedTTFFont.
+        std::array<std::optional<size_t>, 128> ascii_font;
+        std::unordered_map<uint32_t, size_t> codepoint_font;
+        std::unordered_map<std::string, size_t> cluster_font;
 };
 
 #endif // TILES
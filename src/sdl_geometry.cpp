@@ -1,6 +1,10 @@
 #if defined(TILES)
 #include "sdl_geometry.h"
 
+#include <cmath>
+#include <utility>
+
+#include "math_defines.h"
 #include "point.h"
 
 void GeometryRenderer::horizontal_line( const SDL_Renderer_Ptr &renderer, const point &pos, int x2,
@@ -24,6 +28,36 @@ void GeometryRenderer::rect( const SDL_Renderer_Ptr &renderer, const point &pos,
     this->rect( renderer, rect, color );
 }
 
+void GeometryRenderer::sprite( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture,
+                               const SDL_Rect &src, const SDL_Rect &dst, const double angle,
+                               const CataFlipMode flip )
+{
+    RenderCopyEx( renderer, texture, &src, &dst, angle, nullptr, flip );
+}
+
+void GeometryRenderer::tinted_sprite( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture,
+                                      const SDL_Rect &src, const SDL_Rect &dst, const SDL_FColor &color )
+{
+    SDL_FColor old = { 1.0f, 1.0f, 1.0f, 1.0f };
+    if( texture ) {
+        SDL_GetTextureColorModFloat( texture, &old.r, &old.g, &old.b );
+        SDL_GetTextureAlphaModFloat( texture, &old.a );
+        SDL_SetTextureColorModFloat( texture, color.r, color.g, color.b );
+        SDL_SetTextureAlphaModFloat( texture, color.a );
+    }
+    RenderCopyEx( renderer, texture, &src, &dst, 0, nullptr, SDL_FLIP_NONE );
+    if( texture ) {
+        SDL_SetTextureColorModFloat( texture, old.r, old.g, old.b );
+        SDL_SetTextureAlphaModFloat( texture, old.a );
+    }
+}
+
+DefaultGeometryRenderer::~DefaultGeometryRenderer()
+{
+    // The renderer may already be gone, so never draw from here.
+    drop_sprites();
+}
+
 void DefaultGeometryRenderer::rect( const SDL_Renderer_Ptr &renderer, const SDL_Rect &rect,
                                     const SDL_Color &color ) const
 {
@@ -31,4 +65,139 @@ void DefaultGeometryRenderer::rect( const SDL_Renderer_Ptr &renderer, const SDL_
     RenderFillRect( renderer, &rect );
 }
 
+bool DefaultGeometryRenderer::batch_texture_for( const SDL_Renderer_Ptr &renderer,
+        SDL_Texture *texture )
+{
+    if( !renderer || !texture ) {
+        return false;
+    }
+    if( texture != batch_texture || renderer.get() != batch_renderer ) {
+        flush_sprites();
+        if( !SDL_GetTextureSize( texture, &batch_texture_w, &batch_texture_h ) ||
+            batch_texture_w <= 0.0f || batch_texture_h <= 0.0f ) {
+            return false;
+        }
+        batch_texture = texture;
+        batch_renderer = renderer.get();
+    }
+    if( vertices.empty() ) {
+        set_pending_draws( &DefaultGeometryRenderer::flush_pending, this );
+    }
+    return true;
+}
+
+void DefaultGeometryRenderer::sprite( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture,
+                                      const SDL_Rect &src, const SDL_Rect &dst, const double angle,
+                                      const CataFlipMode flip )
+{
+    if( !batch_texture_for( renderer, texture ) ) {
+        // Let the wrapper draw it, or report it.
+        GeometryRenderer::sprite( renderer, texture, src, dst, angle, flip );
+        return;
+    }
+
+    // SDL_RenderGeometry ignores the texture color and alpha mod, it takes
+    // them per vertex instead.
+    SDL_FColor color = { 1.0f, 1.0f, 1.0f, 1.0f };
+    SDL_GetTextureColorModFloat( texture, &color.r, &color.g, &color.b );
+    SDL_GetTextureAlphaModFloat( texture, &color.a );
+    queue_quad( src, dst, angle, flip, color );
+}
+
+void DefaultGeometryRenderer::tinted_sprite( const SDL_Renderer_Ptr &renderer,
+        SDL_Texture *texture, const SDL_Rect &src, const SDL_Rect &dst, const SDL_FColor &color )
+{
+    if( !batch_texture_for( renderer, texture ) ) {
+        GeometryRenderer::tinted_sprite( renderer, texture, src, dst, color );
+        return;
+    }
+    queue_quad( src, dst, 0.0, SDL_FLIP_NONE, color );
+}
+
+void DefaultGeometryRenderer::queue_quad( const SDL_Rect &src, const SDL_Rect &dst,
+        const double angle, const CataFlipMode flip, const SDL_FColor &color )
+{
+    float u0 = static_cast<float>( src.x ) / batch_texture_w;
+    float v0 = static_cast<float>( src.y ) / batch_texture_h;
+    float u1 = static_cast<float>( src.x + src.w ) / batch_texture_w;
+    float v1 = static_cast<float>( src.y + src.h ) / batch_texture_h;
+    if( flip & SDL_FLIP_HORIZONTAL ) {
+        std::swap( u0, u1 );
+    }
+    if( flip & SDL_FLIP_VERTICAL ) {
+        std::swap( v0, v1 );
+    }
+
+    // Corners relative to the center of dst, flipped first and then rotated
+    // clockwise, the same order SDL_RenderTextureRotated uses.
+    const float half_w = dst.w / 2.0f;
+    const float half_h = dst.h / 2.0f;
+    const float center_x = dst.x + half_w;
+    const float center_y = dst.y + half_h;
+    float cos_a = 1.0f;
+    float sin_a = 0.0f;
+    if( angle != 0.0 ) {
+        const double rad = angle * M_PI / 180.0;
+        cos_a = static_cast<float>( std::round( std::cos( rad ) * 1e6 ) / 1e6 );
+        sin_a = static_cast<float>( std::round( std::sin( rad ) * 1e6 ) / 1e6 );
+    }
+    const int base = static_cast<int>( vertices.size() );
+    const auto corner = [&]( const float x, const float y, const float u, const float v ) {
+        const SDL_FPoint pos = { center_x + x * cos_a - y * sin_a, center_y + x * sin_a + y * cos_a };
+        vertices.push_back( { pos, color, { u, v } } );
+    };
+    corner( -half_w, -half_h, u0, v0 );
+    corner( half_w, -half_h, u1, v0 );
+    corner( half_w, half_h, u1, v1 );
+    corner( -half_w, half_h, u0, v1 );
+    indices.insert( indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 } );
+}
+
+void DefaultGeometryRenderer::flush_pending( void *const self )
+{
+    static_cast<DefaultGeometryRenderer *>( self )->flush_sprites();
+}
+
+void DefaultGeometryRenderer::flush_sprites()
+{
+    if( vertices.empty() ) {
+        return;
+    }
+    // The hook is already cleared when called through flush_pending_draws.
+    set_pending_draws( nullptr, nullptr );
+    // A latched renderer may be dangling, the frame is redrawn after recovery anyway.
+    if( !renderer_boundary_recovery_pending() ) {
+        printErrorIf( !SDL_RenderGeometry( batch_renderer, batch_texture, vertices.data(),
+                                           static_cast<int>( vertices.size() ), indices.data(),
+                                           static_cast<int>( indices.size() ) ),
+                      "SDL_RenderGeometry failed" );
+    }
+    vertices.clear();
+    indices.clear();
+    // The texture may be destroyed and its address reused before the next sprite.
+    batch_texture = nullptr;
+}
+
+void DefaultGeometryRenderer::drop_sprites()
+{
+    if( !vertices.empty() ) {
+        set_pending_draws( nullptr, nullptr );
+    }
+    vertices.clear();
+    indices.clear();
+    batch_renderer = nullptr;
+    batch_texture = nullptr;
+}
+
+void DefaultGeometryRenderer::release_gpu_resources()
+{
+    drop_sprites();
+}
+
+void DefaultGeometryRenderer::rebuild_for_renderer( const SDL_Renderer_Ptr &renderer )
+{
+    ( void )renderer;
+    drop_sprites();
+}
+
 #endif // TILES
@@ -4,6 +4,7 @@
 
 #if defined(TILES)
 #include <memory>
+#include <vector>
 
 #include "sdl_wrappers.h"
 
@@ -29,6 +30,22 @@ class GeometryRenderer
             ( void )renderer;
         }
 
+        /// Renders the @p src part of @p texture to @p dst, like @ref RenderCopyEx
+        /// rotating around the center of @p dst. Implementations may defer the
+        /// draw to batch it with others; it is still submitted in order.
+        virtual void sprite( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture,
+                             const SDL_Rect &src, const SDL_Rect &dst, double angle,
+                             CataFlipMode flip );
+
+        /// As @ref sprite without rotation or flip, but multiplied by @p color
+        /// instead of the color and alpha mod of @p texture, so one texture can
+        /// be drawn in many colors within a batch.
+        virtual void tinted_sprite( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture,
+                                    const SDL_Rect &src, const SDL_Rect &dst, const SDL_FColor &color );
+
+        /// Submits any sprites deferred by @ref sprite or @ref tinted_sprite.
+        virtual void flush_sprites() {}
+
         /// Renders a point+width+height defined rectangle with given color.
         void rect( const SDL_Renderer_Ptr &renderer, const point &pos, int width, int height,
                    const SDL_Color &color ) const;
@@ -44,11 +61,42 @@ class GeometryRenderer
 using GeometryRenderer_Ptr = std::unique_ptr<GeometryRenderer>;
 
 /// Implementation of a GeometryRenderer using default RenderFillRect.
+/// Consecutive sprites from the same texture are collected into one vertex
+/// buffer and submitted with a single SDL_RenderGeometry call, so the cost
+/// of drawing the map grows with the number of atlas switches rather than
+/// with the number of sprites.
 class DefaultGeometryRenderer : public GeometryRenderer
 {
     public:
+        ~DefaultGeometryRenderer() override;
+
         void rect( const SDL_Renderer_Ptr &renderer, const SDL_Rect &rect,
                    const SDL_Color &color ) const override;
+        void sprite( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture,
+                     const SDL_Rect &src, const SDL_Rect &dst, double angle,
+                     CataFlipMode flip ) override;
+        void tinted_sprite( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture,
+                            const SDL_Rect &src, const SDL_Rect &dst, const SDL_FColor &color ) override;
+        void flush_sprites() override;
+        void release_gpu_resources() override;
+        void rebuild_for_renderer( const SDL_Renderer_Ptr &renderer ) override;
+
+    private:
+        /// Starts a new batch if @p texture differs from the current one.
+        /// @returns false if the texture cannot be batched and must be drawn directly.
+        bool batch_texture_for( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture );
+        void queue_quad( const SDL_Rect &src, const SDL_Rect &dst, double angle, CataFlipMode flip,
+                         const SDL_FColor &color );
+        static void flush_pending( void *self );
+        /// Forgets queued sprites without drawing them.
+        void drop_sprites();
+
+        SDL_Renderer *batch_renderer = nullptr;
+        SDL_Texture *batch_texture = nullptr;
+        float batch_texture_w = 1.0f;
+        float batch_texture_h = 1.0f;
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
 };
 
 #endif // TILES
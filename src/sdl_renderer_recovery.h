@@ -472,6 +472,19 @@ struct renderer_recovery_test_support {
     // on the stack, then close it. Reports whether the display buffer was bound
     // inside the scope and whether the target returned to NULL after it.
     static void pause_during_draw_scope( bool &bound_during, bool &null_after );
+
+    // Render benchmark support. Load the configured typefaces and palette and
+    // build the UI and map fonts on the fixture renderer, adopting the configured
+    // cell size; teardown releases them. False if the font config cannot load.
+    static bool setup_fonts();
+    // A tile context bound to the fixture renderer that loads its tilesets
+    // through `cache`, so they stay out of the global one. Must be destroyed
+    // before teardown, and before `cache`.
+    static std::unique_ptr<cata_tiles> make_tile_context( tileset_cache &cache );
+    // Present the display buffer to the fixture window, as refresh_display()
+    // does outside of tests. That is where the renderer carries out the draws
+    // queued during the frame.
+    static void present_frame();
 };
 
 // RAII wrapper around setup/teardown for use as a Catch2 fixture local.
@@ -20,7 +20,7 @@ static color_pixel_function_map builtin_color_pixel_functions = {
     { "color_pixel_sepia_light", color_pixel_sepia_light },
     { "color_pixel_sepia_dark", color_pixel_sepia_dark },
     { "color_pixel_blue_dark", color_pixel_blue_dark },
-    { "color_pixel_custom", color_pixel_custom },
+    { "color_pixel_custom", static_cast<color_pixel_function_pointer>( color_pixel_custom ) },
     { "color_pixel_grayscale", color_pixel_grayscale },
     { "color_pixel_nightvision", color_pixel_nightvision },
     { "color_pixel_overexposed", color_pixel_overexposed },
@@ -37,6 +37,23 @@ color_pixel_function_pointer get_color_pixel_function( const std::string &name )
     return iter->second;
 }
 
+color_pixel_custom_params get_color_pixel_custom_params()
+{
+    return {
+        {
+            static_cast<Uint8>( get_option<int>( "MEMORY_RGB_DARK_RED" ) ),
+            static_cast<Uint8>( get_option<int>( "MEMORY_RGB_DARK_GREEN" ) ),
+            static_cast<Uint8>( get_option<int>( "MEMORY_RGB_DARK_BLUE" ) ), 0
+        },
+        {
+            static_cast<Uint8>( get_option<int>( "MEMORY_RGB_BRIGHT_RED" ) ),
+            static_cast<Uint8>( get_option<int>( "MEMORY_RGB_BRIGHT_GREEN" ) ),
+            static_cast<Uint8>( get_option<int>( "MEMORY_RGB_BRIGHT_BLUE" ) ), 0
+        },
+        get_option<float>( "MEMORY_GAMMA" )
+    };
+}
+
 SDL_Color adjust_color_brightness( const SDL_Color &color, int percent )
 {
     if( percent <= 0 ) {
@@ -66,11 +66,25 @@ inline SDL_Color color_pixel_blue_dark( const SDL_Color &color )
     return color_pixel_mixer( color, 1.0f, dark, light );
 }
 
+// The colors and gamma of the "color_pixel_custom" filter, as set in the options.
+struct color_pixel_custom_params {
+    SDL_Color dark;
+    SDL_Color light;
+    float gamma;
+};
+color_pixel_custom_params get_color_pixel_custom_params();
+
+inline SDL_Color color_pixel_custom( const SDL_Color &color,
+                                     const color_pixel_custom_params &params )
+{
+    const SDL_Color dark = { params.dark.r, params.dark.g, params.dark.b, color.a };
+    const SDL_Color light = { params.light.r, params.light.g, params.light.b, color.a };
+    return color_pixel_mixer( color, params.gamma, dark, light );
+}
+
 inline SDL_Color color_pixel_custom( const SDL_Color &color )
 {
-    const SDL_Color dark = { static_cast<Uint8>( get_option<int>( "MEMORY_RGB_DARK_RED" ) ), static_cast<Uint8>( get_option<int>( "MEMORY_RGB_DARK_GREEN" ) ), static_cast<Uint8>( get_option<int>( "MEMORY_RGB_DARK_BLUE" ) ), color.a };
-    const SDL_Color light = { static_cast<Uint8>( get_option<int>( "MEMORY_RGB_BRIGHT_RED" ) ), static_cast<Uint8>( get_option<int>( "MEMORY_RGB_BRIGHT_GREEN" ) ), static_cast<Uint8>( get_option<int>( "MEMORY_RGB_BRIGHT_BLUE" ) ), color.a };
-    return color_pixel_mixer( color, get_option<float>( "MEMORY_GAMMA" ), dark, light );
+    return color_pixel_custom( color, get_color_pixel_custom_params() );
 }
 
 SDL_Color curses_color_to_SDL( const nc_color &color );
@@ -60,9 +60,32 @@ static SDL_ScaleMode scale_quality_to_mode( const std::string &quality )
     return SDL_SCALEMODE_LINEAR;
 }
 
+static pending_draws_flush pending_flush = nullptr;
+static void *pending_flush_owner = nullptr;
+
+void set_pending_draws( const pending_draws_flush flush, void *const owner )
+{
+    pending_flush = flush;
+    pending_flush_owner = owner;
+}
+
+void flush_pending_draws()
+{
+    if( pending_flush == nullptr ) {
+        return;
+    }
+    const pending_draws_flush flush = pending_flush;
+    void *const owner = pending_flush_owner;
+    // Clear first, the flush itself may go through the wrappers.
+    pending_flush = nullptr;
+    pending_flush_owner = nullptr;
+    flush( owner );
+}
+
 void RenderCopy( const SDL_Renderer_Ptr &renderer, const SDL_Texture_Ptr &texture,
                  const SDL_Rect *srcrect, const SDL_Rect *dstrect )
 {
+    flush_pending_draws();
     if( !renderer ) {
         dbg( D_ERROR ) << "Tried to render to a null renderer";
         return;
@@ -191,6 +214,7 @@ void SetRenderDrawColor( const SDL_Renderer_Ptr &renderer, const Uint8 r, const
 
 void RenderDrawPoint( const SDL_Renderer_Ptr &renderer, const point &p )
 {
+    flush_pending_draws();
     printErrorIf( !SDL_RenderPoint( renderer.get(), static_cast<float>( p.x ),
                                     static_cast<float>( p.y ) ),
                   "SDL_RenderPoint failed" );
@@ -198,6 +222,7 @@ void RenderDrawPoint( const SDL_Renderer_Ptr &renderer, const point &p )
 
 void RenderFillRect( const SDL_Renderer_Ptr &renderer, const SDL_Rect *const rect )
 {
+    flush_pending_draws();
     if( !renderer ) {
         dbg( D_ERROR ) << "Tried to use a null renderer";
         return;
@@ -226,6 +251,7 @@ void SetTextureBlendMode( const SDL_Texture_Ptr &texture, SDL_BlendMode blendMod
     if( !texture ) {
         dbg( D_ERROR ) << "Tried to use a null texture";
     }
+    flush_pending_draws();
 
     throwErrorIf( !SDL_SetTextureBlendMode( texture.get(), blendMode ),
                   "SDL_SetTextureBlendMode failed" );
@@ -237,6 +263,7 @@ void SetTextureBlendMode( const std::shared_ptr<SDL_Texture> &texture, SDL_Blend
         dbg( D_ERROR ) << "Tried to use a null texture";
         return;
     }
+    flush_pending_draws();
     throwErrorIf( !SDL_SetTextureBlendMode( texture.get(), blendMode ),
                   "SDL_SetTextureBlendMode failed" );
 }
@@ -314,6 +341,7 @@ scoped_render_target::scoped_render_target( const SDL_Renderer_Ptr &renderer,
     }
     renderer_ = renderer.get();
     vp_ = vp;
+    flush_pending_draws();
     // Flush the pass FIRST so an embargoed pass refuses before any SDL call;
     // only then capture prior_target_ and switch.
     if( vp_ && !vp_->flush() ) {
@@ -349,6 +377,7 @@ bool scoped_render_target::restore()
         boundary_intact_ = false;
         return false;
     }
+    flush_pending_draws();
     if( vp_ && !vp_->flush() ) {
         // Undefined shader-state bind: do not switch the target.
         dbg( D_ERROR ) << "scoped_render_target::restore: variant_pass flush failed";
@@ -388,6 +417,7 @@ scoped_render_target::~scoped_render_target()
 bind_result permanent_render_target_bind( const SDL_Renderer_Ptr &renderer, SDL_Texture *target,
         cata_shader::variant_pass *vp )
 {
+    flush_pending_draws();
     if( !renderer ) {
         dbg( D_ERROR ) << "permanent_render_target_bind: null renderer";
         // No SDL call issued, so no embargo: pre-switch refusal.
@@ -411,6 +441,7 @@ bind_result permanent_render_target_bind( const SDL_Renderer_Ptr &renderer, SDL_
 
 void RenderClear( const SDL_Renderer_Ptr &renderer )
 {
+    flush_pending_draws();
     if( !renderer ) {
         dbg( D_ERROR ) << "Tried to use a null renderer";
         return;
@@ -453,6 +484,7 @@ void RenderCopyEx( const SDL_Renderer_Ptr &renderer, SDL_Texture *const texture,
                    const double angle, const SDL_Point *const center,
                    const CataFlipMode flip )
 {
+    flush_pending_draws();
     if( !renderer ) {
         dbg( D_ERROR ) << "Tried to render to a null renderer";
         return;
@@ -474,6 +506,7 @@ void RenderCopyEx( const SDL_Renderer_Ptr &renderer, SDL_Texture *const texture,
 
 void RenderSetClipRect( const SDL_Renderer_Ptr &renderer, const SDL_Rect *const rect )
 {
+    flush_pending_draws();
     if( !renderer ) {
         dbg( D_ERROR ) << "Tried to use a null renderer";
         return;
@@ -790,6 +823,7 @@ void RenderPresent( const SDL_Renderer_Ptr &renderer )
     if( !renderer ) {
         return;
     }
+    flush_pending_draws();
     printErrorIf( !SDL_RenderPresent( renderer.get() ), "SDL_RenderPresent failed" );
 }
 
@@ -798,6 +832,7 @@ void RenderDrawRect( const SDL_Renderer_Ptr &renderer, const SDL_Rect *rect )
     if( !renderer ) {
         return;
     }
+    flush_pending_draws();
     if( rect ) {
         SDL_FRect fr = to_frect( *rect );
         printErrorIf( !SDL_RenderRect( renderer.get(), &fr ), "SDL_RenderRect failed" );
@@ -819,6 +854,7 @@ void RenderSetLogicalSize( const SDL_Renderer_Ptr &renderer, const int w, const
     if( !renderer ) {
         return;
     }
+    flush_pending_draws();
     printErrorIf( !SDL_SetRenderLogicalPresentation( renderer.get(), w, h,
                   SDL_LOGICAL_PRESENTATION_LETTERBOX ),
                   "SDL_SetRenderLogicalPresentation failed" );
@@ -829,6 +865,7 @@ void RenderSetScale( const SDL_Renderer_Ptr &renderer, const float scaleX, const
     if( !renderer ) {
         return;
     }
+    flush_pending_draws();
     printErrorIf( !SDL_SetRenderScale( renderer.get(), scaleX, scaleY ),
                   "SDL_SetRenderScale failed" );
 }
@@ -839,6 +876,7 @@ bool RenderReadPixels( const SDL_Renderer_Ptr &renderer, const SDL_Rect *rect,
     if( !renderer ) {
         return false;
     }
+    flush_pending_draws();
     ( void )format;
     SDL_Surface *surf = SDL_RenderReadPixels( renderer.get(), rect );
     if( !surf ) {
@@ -233,6 +233,16 @@ void RenderCopyEx( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture,
                    const SDL_Rect *srcrect, const SDL_Rect *dstrect,
                    double angle, const SDL_Point *center, CataFlipMode flip );
 void RenderSetClipRect( const SDL_Renderer_Ptr &renderer, const SDL_Rect *rect );
+
+// Batching renderers (see DefaultGeometryRenderer) queue draws instead of
+// issuing them, and register a flush callback while anything is queued.
+// Every wrapper here that draws, presents, reads back, or changes the render
+// target, clip rect, scale or a texture's blend mode submits the queue first,
+// so queued draws land in the order they were made. Code that draws through
+// SDL directly must call flush_pending_draws() itself.
+using pending_draws_flush = void ( * )( void *owner );
+void set_pending_draws( pending_draws_flush flush, void *owner );
+void flush_pending_draws();
 void RenderGetClipRect( const SDL_Renderer_Ptr &renderer, SDL_Rect *rect );
 bool RenderIsClipEnabled( const SDL_Renderer_Ptr &renderer );
 int BlitSurface( const SDL_Surface_Ptr &src, const SDL_Rect *srcrect,
@@ -2108,6 +2108,9 @@ void renderer_recovery_test_support::teardown_software_renderer()
     display_buffer_scope_invalid = false;
     display_buffer_scope_recovery_required = false;
     reset_coordinator();
+    // Fonts own glyph atlas textures on the fixture renderer.
+    map_font.reset();
+    font.reset();
     geometry.reset();
     shared_variant_pass.reset();
     display_buffer.reset();
@@ -2317,6 +2320,40 @@ void renderer_recovery_test_support::pause_during_draw_scope( bool &bound_during
     null_after = GetRenderTarget( renderer ) == nullptr;
 }
 
+bool renderer_recovery_test_support::setup_fonts()
+{
+    font_loader fl;
+    try {
+        fl.load();
+        color_loader<SDL_Color>().load( windowsPalette );
+    } catch( const std::exception &err ) {
+        dbg( D_ERROR ) << "failed to load the benchmark fonts: " << err.what();
+        return false;
+    }
+    fontwidth = fl.fontwidth;
+    fontheight = fl.fontheight;
+    font = std::make_unique<FontFallbackList>( renderer, pixel_format, fl.fontwidth, fl.fontheight,
+            windowsPalette, fl.typeface, fl.fontsize, fl.fontblending );
+    map_font = std::make_unique<FontFallbackList>( renderer, pixel_format, fl.map_fontwidth,
+               fl.map_fontheight, windowsPalette, fl.map_typeface, fl.map_fontsize,
+               fl.fontblending );
+    return true;
+}
+
+std::unique_ptr<cata_tiles> renderer_recovery_test_support::make_tile_context(
+    tileset_cache &cache )
+{
+    return std::make_unique<cata_tiles>( renderer, geometry, cache );
+}
+
+void renderer_recovery_test_support::present_frame()
+{
+    // refresh_display() returns early in test mode.
+    restore_on_out_of_scope<bool> restore_test_mode( test_mode );
+    test_mode = false;
+    refresh_display();
+}
+
 bool renderer_resource_coordinator::apply_resize_only( const uint32_t serviced_resize_epoch )
 {
     // The planner cleared current_claimed_ when it issued this resize, so a
@@ -3324,14 +3361,40 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
     static const std::string space_string = " ";
 
     const bool option_use_draw_ascii_lines_routine = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
-    bool update = false;
+
+    // Collect the lines to redraw first.  Backgrounds and glyphs are then drawn in
+    // two separate passes: every filled rectangle ends the current sprite batch, so
+    // interleaving them would split the glyphs of a window into one draw call per
+    // coloured cell instead of a single batch.
+    std::vector<int> lines;
     for( int j = 0; j < win->height; j++ ) {
         // force_full redraws every line after a renderer rebuild, ignoring the
         // per-line touched skip.
-        if( !force_full && !win->line[j].touched ) {
-            continue;
+        if( force_full || win->line[j].touched ) {
+            lines.push_back( j );
+            win->line[j].touched = false;
+        }
+    }
+
+    // Width of the cell in columns, or 0 if nothing is to be drawn for it.
+    const auto cell_width = [&]( const cursecell & cell, const point & draw ) {
+        if( draw.x + font->width > WindowWidth || draw.y + font->height > WindowHeight ) {
+            // Outside of the display area, would not render anyway
+            return 0;
         }
+        if( cell.ch.empty() ) {
+            return 0; // second cell of a multi-cell character
+        }
+        // Spaces are used a lot, so this does help noticeably
+        if( cell.ch == space_string ) {
+            return 1;
+        }
+        const int cw = UTF8_getch( cell.ch ) == UNKNOWN_UNICODE ? 1 : utf8_width( cell.ch );
+        // utf8_width() may return a negative width
+        return std::max( cw, 0 );
+    };
 
+    for( const int j : lines ) {
         // Although it would be simpler to clear the whole window at
         // once, the code sometimes creates overlapping windows. By
         // only clearing those lines that are touched, we avoid
@@ -3340,37 +3403,32 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
         geometry->rect( renderer, point( win->pos.x * font->width, ( win->pos.y + j ) * font->height ),
                         win->width * font->width, font->height,
                         color_as_sdl( catacurses::black ) );
-        update = true;
-        win->line[j].touched = false;
         for( int i = 0; i < win->width; i++ ) {
             const cursecell &cell = win->line[j].chars[i];
-
-            const point draw( offset + point( i * font->width, j * font->height ) );
-            if( draw.x + font->width > WindowWidth || draw.y + font->height > WindowHeight ) {
-                // Outside of the display area, would not render anyway
+            if( cell.BG == catacurses::black ) {
                 continue;
             }
-
-            if( cell.ch.empty() ) {
-                continue; // second cell of a multi-cell character
+            const point draw( offset + point( i * font->width, j * font->height ) );
+            const int cw = cell_width( cell, draw );
+            if( cw > 0 ) {
+                geometry->rect( renderer, draw, font->width * cw, font->height,
+                                color_as_sdl( cell.BG ) );
             }
+        }
+    }
 
-            // Spaces are used a lot, so this does help noticeably
+    for( const int j : lines ) {
+        for( int i = 0; i < win->width; i++ ) {
+            const cursecell &cell = win->line[j].chars[i];
             if( cell.ch == space_string ) {
-                if( cell.BG != catacurses::black ) {
-                    geometry->rect( renderer, draw, font->width, font->height,
-                                    color_as_sdl( cell.BG ) );
-                }
                 continue;
             }
-            const int codepoint = UTF8_getch( cell.ch );
-            const catacurses::base_color FG = cell.FG;
-            const catacurses::base_color BG = cell.BG;
-            int cw = ( codepoint == UNKNOWN_UNICODE ) ? 1 : utf8_width( cell.ch );
-            if( cw < 1 ) {
-                // utf8_width() may return a negative width
+            const point draw( offset + point( i * font->width, j * font->height ) );
+            if( cell_width( cell, draw ) == 0 ) {
                 continue;
             }
+            const int codepoint = UTF8_getch( cell.ch );
+            const catacurses::base_color FG = cell.FG;
             bool use_draw_ascii_lines_routine = option_use_draw_ascii_lines_routine;
             unsigned char uc = static_cast<unsigned char>( cell.ch[0] );
             switch( codepoint ) {
@@ -3414,10 +3472,6 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
                     use_draw_ascii_lines_routine = false;
                     break;
             }
-            if( cell.BG != catacurses::black ) {
-                geometry->rect( renderer, draw, font->width * cw, font->height,
-                                color_as_sdl( BG ) );
-            }
             if( use_draw_ascii_lines_routine ) {
                 font->draw_ascii_lines( renderer, geometry, uc, draw, FG );
             } else {
@@ -3427,7 +3481,7 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
     }
     win->draw = false; //We drew the window, mark it as so
 
-    return update;
+    return !lines.empty();
 }
 
 static bool draw_window( Font_Ptr &font, const catacurses::window &w,
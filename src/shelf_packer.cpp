@@ -0,0 +1,47 @@
+#include "shelf_packer.h"
+
+shelf_packer::shelf_packer( const int width, const int height, const int padding ) :
+    page_width( width ), page_height( height ), padding( padding )
+{
+}
+
+std::optional<point> shelf_packer::insert( const int w, const int h )
+{
+    if( w <= 0 || h <= 0 ) {
+        return std::nullopt;
+    }
+    const int padded_w = w + padding;
+    const int padded_h = h + padding;
+
+    shelf *best = nullptr;
+    for( shelf &s : shelves ) {
+        if( s.height < padded_h || s.used + padded_w > page_width ) {
+            continue;
+        }
+        if( best == nullptr || s.height < best->height ) {
+            best = &s;
+        }
+    }
+    // A shelf much taller than the rectangle wastes the space above it for good, so
+    // rather open a new one while the page still has room for it.
+    if( best != nullptr && best->height > padded_h + padded_h / 2 &&
+        next_y + padded_h <= page_height ) {
+        best = nullptr;
+    }
+    if( best == nullptr ) {
+        if( next_y + padded_h > page_height || padded_w > page_width ) {
+            return std::nullopt;
+        }
+        best = &shelves.emplace_back( shelf{ next_y, padded_h, 0 } );
+        next_y += padded_h;
+    }
+    const point corner( best->used, best->y );
+    best->used += padded_w;
+    return corner;
+}
+
+void shelf_packer::reset()
+{
+    shelves.clear();
+    next_y = 0;
+}
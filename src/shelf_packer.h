@@ -0,0 +1,57 @@
+#pragma once
+#ifndef CATA_SRC_SHELF_PACKER_H
+#define CATA_SRC_SHELF_PACKER_H
+
+#include <optional>
+#include <vector>
+
+#include "point.h"
+
+/**
+ * Packs rectangles into a fixed-size page, row by row ("shelves"). A rectangle
+ * goes on the existing shelf that wastes the least height and still has room,
+ * otherwise a new shelf as tall as the rectangle is opened below the last one.
+ * Nothing is ever freed individually; the whole page is reset at once.
+ *
+ * This is meant for atlases of similarly sized images, like glyphs of one
+ * font, where it packs nearly as densely as a general packer at a fraction of
+ * the cost.
+ */
+class shelf_packer
+{
+    public:
+        /**
+         * @param padding gap left to the right of and below every rectangle, so
+         * that filtering while sampling one never picks up its neighbours.
+         */
+        shelf_packer( int width, int height, int padding = 1 );
+
+        /** @returns top left corner of the space reserved for a w x h rectangle, if it fits. */
+        std::optional<point> insert( int w, int h );
+        /** Forget every rectangle inserted so far. */
+        void reset();
+
+        int width() const {
+            return page_width;
+        }
+        int height() const {
+            return page_height;
+        }
+
+    private:
+        struct shelf {
+            int y;
+            int height;
+            // x of the first free column
+            int used;
+        };
+
+        int page_width;
+        int page_height;
+        int padding;
+        // y of the first row not claimed by any shelf
+        int next_y = 0;
+        std::vector<shelf> shelves;
+};
+
+#endif // CATA_SRC_SHELF_PACKER_H
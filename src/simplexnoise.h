@@ -20,6 +20,8 @@
 #define CATA_SRC_SIMPLEXNOISE_H
 
 #include <array>
+#include <cfloat>
+#include <cstddef>
 
 /* 2D, 3D and 4D Simplex Noise functions return 'random' values in (-1, 1).
 
@@ -94,6 +96,34 @@ float scaled_octave_noise_4d( float octaves,
                               float z,
                               float w );
 
+// Whether scaled_octave_noise_3d_batch runs its vectorized kernel.
+// The kernel does the same float operations in the same order as the scalar function, which
+// only rounds the same way as long as the compiler cannot fuse multiply-adds. Where it can
+// (FMA targets such as aarch64 or x86 with -march=native) or where floats are evaluated in
+// extended precision, the batch evaluates the points one by one with the scalar function.
+#if defined(__FP_FAST_FMAF) || defined(__FMA__) || defined(__ARM_FEATURE_FMA) || \
+    ( defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0 )
+constexpr bool octave_noise_3d_batch_vectorized = false;
+#else
+constexpr bool octave_noise_3d_batch_vectorized = true;
+#endif
+
+// Batched scaled_octave_noise_3d
+// Sets out[i] to scaled_octave_noise_3d( octaves, persistence, scale, loBound, hiBound,
+// x[i], y[i], z ) for every i < count. The results are identical to calling the scalar
+// function once per point. See octave_noise_3d_batch_vectorized for when the points are
+// processed in groups the compiler can vectorize.
+void scaled_octave_noise_3d_batch( float octaves,
+                                   float persistence,
+                                   float scale,
+                                   float loBound,
+                                   float hiBound,
+                                   const float *x,
+                                   const float *y,
+                                   float z,
+                                   float *out,
+                                   size_t count );
+
 // Scaled Raw Simplex noise
 // The result will be between the two parameters passed.
 float scaled_raw_noise_2d( float loBound,
@@ -0,0 +1,84 @@
+#pragma once
+#ifndef CATA_SRC_SOUND_LISTENER_GRID_H
+#define CATA_SRC_SOUND_LISTENER_GRID_H
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "coordinates.h"
+#include "map_scale_constants.h"
+#include "point.h"
+
+// Buckets values by position into submap-sized cells of the reality bubble, so
+// a sound only looks at listeners in the cells its audible range overlaps.
+// Queries visit values in the order they were added, so hearing happens in the
+// same order (and draws the same random numbers) as a scan of the full list.
+template<typename T>
+class sound_listener_grid
+{
+    public:
+        void add( const tripoint_bub_ms &p, T value ) {
+            cells[cell_index( p.xy() )].push_back( listeners.size() );
+            listeners.emplace_back( p, value );
+        }
+
+        void clear() {
+            for( std::vector<size_t> &cell : cells ) {
+                cell.clear();
+            }
+            listeners.clear();
+        }
+
+        bool empty() const {
+            return listeners.empty();
+        }
+
+        // Calls f( pos, value ) for every value within `range` tiles of `center` on
+        // both axes, on any z-level.
+        template<typename F>
+        void for_each_in_range( const tripoint_bub_ms &center, int range, F &&f ) {
+            if( range < 0 || listeners.empty() ) {
+                return;
+            }
+            const point min_cell = cell_of( center.xy() - point( range, range ) );
+            const point max_cell = cell_of( center.xy() + point( range, range ) );
+            found.clear();
+            for( int cy = min_cell.y; cy <= max_cell.y; cy++ ) {
+                for( int cx = min_cell.x; cx <= max_cell.x; cx++ ) {
+                    const std::vector<size_t> &cell = cells[cx + cy * cells_per_side];
+                    found.insert( found.end(), cell.begin(), cell.end() );
+                }
+            }
+            std::sort( found.begin(), found.end() );
+            for( const size_t i : found ) {
+                const tripoint_bub_ms &p = listeners[i].first;
+                // The cells only bound the range; drop the values past it.
+                if( std::abs( p.x() - center.x() ) <= range &&
+                    std::abs( p.y() - center.y() ) <= range ) {
+                    f( p, listeners[i].second );
+                }
+            }
+        }
+
+    private:
+        static constexpr int cells_per_side = MAPSIZE;
+
+        // Positions outside the bubble are clamped into the edge cells.
+        static point cell_of( const point_bub_ms &p ) {
+            return point( std::clamp( p.x() / SEEX, 0, cells_per_side - 1 ),
+                          std::clamp( p.y() / SEEY, 0, cells_per_side - 1 ) );
+        }
+        static size_t cell_index( const point_bub_ms &p ) {
+            const point c = cell_of( p );
+            return c.x + c.y * cells_per_side;
+        }
+
+        std::array<std::vector<size_t>, cells_per_side * cells_per_side> cells;
+        std::vector<std::pair<tripoint_bub_ms, T>> listeners;
+        std::vector<size_t> found;
+};
+
+#endif // CATA_SRC_SOUND_LISTENER_GRID_H
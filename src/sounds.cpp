@@ -1,6 +1,7 @@
 #include "sounds.h"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
@@ -9,6 +10,8 @@
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "activity_type.h"
 #include "cached_options.h" // IWYU pragma: keep
@@ -35,6 +38,7 @@
 #include "point.h"
 #include "rng.h"
 #include "safemode_ui.h"
+#include "sound_listener_grid.h"
 #include "string_formatter.h"
 #include "translations.h"
 #include "trap.h"
@@ -470,12 +474,33 @@ static int get_signal_for_hordes( const centroid &centr )
     return 0;
 }
 
+
+static void build_sound_listeners( map &here, sound_listener_grid<monster *> &monsters,
+                                   sound_listener_grid<const trap *> &traps )
+{
+    monsters.clear();
+    for( monster &critter : g->all_monsters() ) {
+        monsters.add( critter.pos_bub(), &critter );
+    }
+    traps.clear();
+    for( const trap *trapType : trap::get_sound_triggered_traps() ) {
+        for( const tripoint_bub_ms &tp : here.trap_locations( trapType->id ) ) {
+            traps.add( tp, trapType );
+        }
+    }
+}
+
 void sounds::process_sounds()
 {
     map &here = get_map();
 
     std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
     const int weather_vol = get_weather().weather_id->sound_attn;
+    // Built once per turn, and again only if a triggered trap may have changed the
+    // monsters or traps on the map. Local, as the pointers are only valid this turn.
+    sound_listener_grid<monster *> monsters;
+    sound_listener_grid<const trap *> traps;
+    bool listeners_stale = true;
     for( const centroid &this_centroid : sound_clusters ) {
         // Since monsters don't go deaf ATM we can just use the weather modified volume
         // If they later get physical effects from loud noises we'll have to change this
@@ -492,28 +517,38 @@ void sounds::process_sounds()
             const tripoint_abs_sm target( abs_sm, source.z() );
             overmap_buffer.signal_hordes( target, sig_power );
         }
+        if( listeners_stale ) {
+            build_sound_listeners( here, monsters, traps );
+            listeners_stale = false;
+        }
+        // sound_distance is never less than the distance on either axis, so nothing
+        // further away than this on either axis can hear the sound.
+        const int audible_range = vol * 2 - 1;
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
+        monsters.for_each_in_range( source, audible_range,
+        [&]( const tripoint_bub_ms & pos, monster * critter ) {
             // TODO: Generalize this to Creature::hear_sound
-            const int dist = sound_distance( source, critter.pos_bub() );
+            const int dist = sound_distance( source, pos );
             if( vol * 2 > dist ) {
                 // Exclude monsters that certainly won't hear the sound
-                critter.hear_sound( source, vol, dist, this_centroid.provocative );
+                critter->hear_sound( source, vol, dist, this_centroid.provocative );
             }
-        }
+        } );
         // Trigger sound-triggered traps and ensure they are still valid
-        for( const trap *trapType : trap::get_sound_triggered_traps() ) {
-            for( const tripoint_bub_ms &tp : here.trap_locations( trapType->id ) ) {
-                const int dist = sound_distance( source, tp );
-                const trap &tr = here.tr_at( tp );
-                // Exclude traps that certainly won't hear the sound
-                if( vol * 2 > dist ) {
-                    if( tr.triggered_by_sound( vol, dist ) ) {
-                        tr.trigger( tp );
-                    }
+        traps.for_each_in_range( source, audible_range,
+        [&]( const tripoint_bub_ms & tp, const trap * trapType ) {
+            const int dist = sound_distance( source, tp );
+            const trap &tr = here.tr_at( tp );
+            // Exclude traps that certainly won't hear the sound, and traps
+            // replaced since the listeners were built
+            if( vol * 2 > dist && tr.loadid == trapType->loadid ) {
+                if( tr.triggered_by_sound( vol, dist ) ) {
+                    tr.trigger( tp );
+                    // The trap may have spawned or killed monsters, or removed traps.
+                    listeners_stale = true;
                 }
             }
-        }
+        } );
     }
     recent_sounds.clear();
 }
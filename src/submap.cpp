@@ -18,15 +18,52 @@ static furn_id f_null;
 
 static const furn_str_id furn_f_console( "f_console" );
 
+maptile_soa::maptile_soa( const ter_id &fill_ter ) : ter( fill_ter ),
+    frn( furn_str_id::NULL_ID() ), lum( 0 ), trp( tr_null ), rad( 0 )
+{
+}
+
+template<typename T>
+static void swap_shared_tile( shared_soa_layer<T> &layer, const point_sm_ms &p1,
+                              const point_sm_ms &p2 )
+{
+    if( layer[p1.x()][p1.y()] != layer[p2.x()][p2.y()] ) {
+        std::swap( layer.get_mutable( p1.x() )[p1.y()], layer.get_mutable( p2.x() )[p2.y()] );
+    }
+}
+
 void maptile_soa::swap_soa_tile( const point_sm_ms &p1, const point_sm_ms &p2 )
 {
-    std::swap( ter[p1.x()][p1.y()], ter[p2.x()][p2.y()] );
-    std::swap( frn[p1.x()][p1.y()], frn[p2.x()][p2.y()] );
-    std::swap( lum[p1.x()][p1.y()], lum[p2.x()][p2.y()] );
-    std::swap( itm[p1.x()][p1.y()], itm[p2.x()][p2.y()] );
-    std::swap( fld[p1.x()][p1.y()], fld[p2.x()][p2.y()] );
-    std::swap( trp[p1.x()][p1.y()], trp[p2.x()][p2.y()] );
-    std::swap( rad[p1.x()][p1.y()], rad[p2.x()][p2.y()] );
+    swap_shared_tile( ter, p1, p2 );
+    swap_shared_tile( frn, p1, p2 );
+    swap_shared_tile( lum, p1, p2 );
+    if( itm.is_allocated() ) {
+        std::swap( itm.get_mutable( p1.x() )[p1.y()], itm.get_mutable( p2.x() )[p2.y()] );
+    }
+    if( fld.is_allocated() ) {
+        std::swap( fld.get_mutable( p1.x() )[p1.y()], fld.get_mutable( p2.x() )[p2.y()] );
+    }
+    swap_shared_tile( trp, p1, p2 );
+    swap_shared_tile( rad, p1, p2 );
+}
+
+void maptile_soa::release_empty_layers()
+{
+    itm.release_if( []( const cata::colony<item> &items ) {
+        return items.empty();
+    } );
+    fld.release_if( []( const field &f ) {
+        return f.field_count() == 0;
+    } );
+}
+
+void maptile_soa::share_identical_layers()
+{
+    ter.share_identical();
+    frn.share_identical();
+    lum.share_identical();
+    trp.share_identical();
+    rad.share_identical();
 }
 
 submap::submap( submap && ) noexcept( map_is_noexcept ) = default;
@@ -36,9 +73,28 @@ submap &submap::operator=( submap && ) noexcept = default;
 
 void submap::clear_fields( const point_sm_ms &p )
 {
+    if( !has_field_layer() ) {
+        return;
+    }
     field &f = get_field( p );
     field_count -= f.field_count();
     f.clear();
+    set_field_tile( p, false );
+}
+
+void submap::rebuild_field_tiles()
+{
+    field_tiles.reset();
+    if( is_uniform() || !m->fld.is_allocated() ) {
+        return;
+    }
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            if( m->fld[x][y].field_count() > 0 ) {
+                set_field_tile( { x, y }, true );
+            }
+        }
+    }
 }
 
 static const std::string COSMETICS_GRAFFITI( "GRAFFITI" );
@@ -276,6 +332,7 @@ void submap::rotate( int turns )
         rot_comp.emplace( rotate_point( elem.first ), elem.second );
     }
     computers = rot_comp;
+    rebuild_field_tiles();
 }
 
 void submap::mirror( bool horizontally )
@@ -320,6 +377,7 @@ void submap::mirror( bool horizontally )
         }
         computers = mirror_comp;
     }
+    rebuild_field_tiles();
 }
 
 void submap::revert_submap( submap &sr )
@@ -327,19 +385,29 @@ void submap::revert_submap( submap &sr )
     reverted = true;
     if( sr.is_uniform() ) {
         m.reset();
+        field_tiles.reset();
         set_all_ter( sr.get_ter( point_sm_ms::zero ), true );
         return;
     }
 
     ensure_nonuniform();
-    for( int x = 0; x < SEEX; x++ ) {
+    // Go through the item layers only if the revert submap has one, so reverting to a
+    // submap without items does not allocate them on either side.
+    const maptile_soa &src = *sr.m;
+    const bool has_items = src.itm.is_allocated();
+    if( !has_items ) {
+        m->itm = decltype( m->itm )();
+    }
+    // Shared with the revert submap until either of them changes.
+    m->frn = src.frn;
+    m->ter = src.ter;
+    m->trp = src.trp;
+    for( int x = 0; has_items && x < SEEX; x++ ) {
         for( int y = 0; y < SEEY; y++ ) {
             point_sm_ms pt( x, y );
-            m->frn[x][y] = sr.get_furn( pt );
-            m->ter[x][y] = sr.get_ter( pt );
-            m->trp[x][y] = sr.get_trap( pt );
-            m->itm[x][y] = sr.get_items( pt );
-            for( item &itm : m->itm[x][y] ) {
+            cata::colony<item> &items = m->itm.get_mutable( x )[y];
+            items = src.itm[x][y];
+            for( item &itm : items ) {
                 if( itm.is_emissive() ) {
                     this->update_lum_add( pt, itm );
                 }
@@ -370,7 +438,7 @@ void submap::update_lum_rem( const point_sm_ms &p, const item &i )
     if( !i.is_emissive() ) {
         return;
     } else if( m->lum[p.x()][p.y()] && m->lum[p.x()][p.y()] < 255 ) {
-        m->lum[p.x()][p.y()]--;
+        m->lum.get_mutable( p.x() )[p.y()]--;
         return;
     }
 
@@ -384,58 +452,62 @@ void submap::update_lum_rem( const point_sm_ms &p, const item &i )
     }
 
     if( count <= 256 ) {
-        m->lum[p.x()][p.y()] = static_cast<uint8_t>( count - 1 );
+        m->lum.set( p, static_cast<uint8_t>( count - 1 ) );
     }
 }
 
 void submap::merge_submaps( submap *copy_from, bool copy_from_is_overlay )
 {
     this->field_count = 0;
+    // Read through a const reference so empty layers of the overlay are not allocated.
+    const maptile_soa &overlay = *copy_from->m;
 
     for( int x = 0; x < SEEX; x++ ) {
         for( int y = 0; y < SEEY; y++ ) {
-            if( copy_from->m->ter[x][y] != t_null && ( copy_from_is_overlay ||
-                    this->m->ter[x][y] == t_null ) ) {
-                this->m->ter[x][y] = copy_from->m->ter[x][y];
-                this->set_map_damage( { x, y }, copy_from->get_map_damage( { x, y } ) );
+            const point_sm_ms p( x, y );
+            if( overlay.ter[x][y] != t_null && ( copy_from_is_overlay ||
+                                                 this->m->ter[x][y] == t_null ) ) {
+                this->m->ter.set( p, overlay.ter[x][y] );
+                this->set_map_damage( p, copy_from->get_map_damage( p ) );
             }
 
-            if( copy_from->m->frn[x][y] != f_null && ( copy_from_is_overlay ||
-                    this->m->frn[x][y] == f_null ) ) {
-                this->m->frn[x][y] = copy_from->m->frn[x][y];
+            if( overlay.frn[x][y] != f_null && ( copy_from_is_overlay ||
+                                                 this->m->frn[x][y] == f_null ) ) {
+                this->m->frn.set( p, overlay.frn[x][y] );
             }
 
-            this->m->lum[x][y] += copy_from->m->lum[x][y];
+            if( overlay.lum[x][y] != 0 ) {
+                this->m->lum.get_mutable( x )[y] += overlay.lum[x][y];
+            }
 
-            for( const item &itm : copy_from->m->itm[x][y] ) {
-                const auto iter = this->m->itm[x][y].emplace( itm );
+            for( const item &itm : overlay.itm[x][y] ) {
+                const auto iter = this->m->itm.get_mutable( x )[y].emplace( itm );
                 this->active_items.add( *iter, point_sm_ms( x, y ) );
             }
 
-            for( std::map<field_type_id, field_entry>::iterator it = copy_from->m->fld[x][y].begin();
-                 it != copy_from->m->fld[x][y].end(); it++ ) {
-                if( !this->m->fld[x][y].find_field( it->first, false ) ) {
-                    this->m->fld[x][y].add_field( it->first, it->second.get_field_intensity(),
-                                                  it->second.get_field_age() );
+            for( auto it = overlay.fld[x][y].begin(); it != overlay.fld[x][y].end(); it++ ) {
+                field &here = this->m->fld.get_mutable( x )[y];
+                if( !here.find_field( it->first, false ) ) {
+                    here.add_field( it->first, it->second.get_field_intensity(),
+                                    it->second.get_field_age() );
                 } else if( copy_from_is_overlay ) { // Modify the field to match
-                    field_entry *fld = this->m->fld[x][y].find_field( it->first, false );
+                    field_entry *fld = here.find_field( it->first, false );
                     fld->set_field_intensity( it->second.get_field_intensity() );
                     fld->set_field_age( it->second.get_field_age() );
                 }
             }
 
-            for( std::map<field_type_id, field_entry>::iterator it = this->m->fld[x][y].begin();
-                 it != this->m->fld[x][y].end(); it++ ) {
-                this->field_count++;
+            if( this->m->fld.is_allocated() ) {
+                this->field_count += static_cast<int>( this->m->fld[x][y].field_count() );
             }
 
-            if( copy_from->m->trp[x][y] != tr_null && ( copy_from_is_overlay ||
-                    this->m->trp[x][y] == tr_null ) ) {
-                this->m->trp[x][y] = copy_from->m->trp[x][y];
+            if( overlay.trp[x][y] != tr_null && ( copy_from_is_overlay ||
+                                                  this->m->trp[x][y] == tr_null ) ) {
+                this->m->trp.set( p, overlay.trp[x][y] );
             }
 
-            if( copy_from->m->rad[x][y] > 0 && ( copy_from_is_overlay || this->m->rad[x][y] == 0 ) ) {
-                this->m->rad[x][y] = copy_from->m->rad[x][y];
+            if( overlay.rad[x][y] > 0 && ( copy_from_is_overlay || this->m->rad[x][y] == 0 ) ) {
+                this->m->rad.set( p, overlay.rad[x][y] );
             }
         }
     }
@@ -488,6 +560,7 @@ void submap::merge_submaps( submap *copy_from, bool copy_from_is_overlay )
             this->set_computer( comp.first, comp.second );
         }
     }
+    rebuild_field_tiles();
 
     if( copy_from->temperature_mod != 0 && this->temperature_mod == 0 ) {
         this->temperature_mod = copy_from->temperature_mod;
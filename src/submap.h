@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_SUBMAP_H
 #define CATA_SRC_SUBMAP_H
 
+#include <algorithm>
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -10,6 +12,7 @@
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -23,6 +26,7 @@
 #include "construction.h"
 #include "coordinates.h"
 #include "field.h"
+#include "hash_utils.h"
 #include "item.h"
 #include "map_scale_constants.h"
 #include "mapdata.h"
@@ -57,18 +61,208 @@ struct spawn_point {
         mission_id( MIS ), friendly( F ), name( N ), data( SD ) {}
 };
 
+/**
+ * A layer of maptile_soa which is only allocated once it is accessed for writing.  Until
+ * then, and again after release_if() finds nothing in it, reads are served from a single
+ * empty layer shared by every submap.
+ *
+ * operator[] only ever reads, even on a non-const layer, so code that merely looks at the
+ * tiles never allocates.  Writers have to ask for get_mutable().
+ */
+template<typename T>
+class lazy_soa_layer
+{
+    public:
+        using array_type = cata::mdarray<T, point_sm_ms>;
+        using column_type = typename array_type::column_type;
+
+        lazy_soa_layer() = default;
+        lazy_soa_layer( const lazy_soa_layer &other ) :
+            data( other.data ? std::make_unique<array_type>( *other.data ) : nullptr ) {}
+        lazy_soa_layer( lazy_soa_layer && ) noexcept = default;
+        ~lazy_soa_layer() = default;
+
+        lazy_soa_layer &operator=( const lazy_soa_layer &other ) {
+            if( this != &other ) {
+                data = other.data ? std::make_unique<array_type>( *other.data ) : nullptr;
+            }
+            return *this;
+        }
+        lazy_soa_layer &operator=( lazy_soa_layer && ) noexcept = default;
+
+        const column_type &operator[]( size_t x ) const {
+            return data ? ( *data )[x] : empty_layer()[x];
+        }
+
+        column_type &get_mutable( size_t x ) {
+            if( !data ) {
+                data = std::make_unique<array_type>();
+            }
+            return ( *data )[x];
+        }
+
+        bool is_allocated() const {
+            return static_cast<bool>( data );
+        }
+
+        /** Frees the layer if every tile in it satisfies @p is_empty. */
+        template<typename F>
+        void release_if( const F &is_empty ) {
+            if( !data ) {
+                return;
+            }
+            for( size_t x = 0; x < array_type::size_x; ++x ) {
+                for( const T &tile : ( *data )[x] ) {
+                    if( !is_empty( tile ) ) {
+                        return;
+                    }
+                }
+            }
+            data.reset();
+        }
+
+    private:
+        static const array_type &empty_layer() {
+            static const array_type empty;
+            return empty;
+        }
+
+        std::unique_ptr<array_type> data;
+};
+
+/**
+ * A layer of maptile_soa that is shared, copy-on-write, between submaps with the same
+ * content in it.  Copying the layer shares it, and share_identical() swaps it for an
+ * identical one some other submap already holds.  Most submaps have the same lights, traps
+ * and radiation (none), and many have the same furniture (none) too.
+ *
+ * operator[] only ever reads.  Writers have to ask for get_mutable(), which first gives
+ * this layer its own copy if it is shared.  Layers are only shared on the main thread.
+ */
+template<typename T>
+class shared_soa_layer
+{
+    public:
+        using array_type = cata::mdarray<T, point_sm_ms>;
+        using column_type = typename array_type::column_type;
+
+        explicit shared_soa_layer( const T &fill ) :
+            data( std::make_unique<array_type>( fill ) ) {
+            share_identical();
+        }
+
+        const column_type &operator[]( size_t x ) const {
+            return ( *data )[x];
+        }
+
+        column_type &get_mutable( size_t x ) {
+            if( is_shared() ) {
+                data = std::make_unique<array_type>( *data );
+            }
+            return ( *data )[x];
+        }
+
+        // Writing what is already there keeps the layer shared.
+        void set( const point_sm_ms &p, const T &value ) {
+            if( ( *data )[p] != value ) {
+                get_mutable( p.x() )[p.y()] = value;
+            }
+        }
+
+        void fill( const T &value ) {
+            if( is_shared() ) {
+                data = std::make_unique<array_type>( value );
+            } else {
+                data->fill( value );
+            }
+        }
+
+        bool is_shared() const {
+            return data.use_count() > 1;
+        }
+        bool shares_with( const shared_soa_layer &other ) const {
+            return data == other.data;
+        }
+
+        /** Shares the layer of another submap instead, if that one has the same content. */
+        void share_identical() {
+            std::unordered_multimap<size_t, std::weak_ptr<array_type>> &layers = known_layers();
+            const size_t hash = content_hash( *data );
+            const auto range = layers.equal_range( hash );
+            for( auto it = range.first; it != range.second; ++it ) {
+                std::shared_ptr<array_type> known = it->second.lock();
+                if( known == data ) {
+                    return;
+                }
+                if( known && same_content( *known, *data ) ) {
+                    data = std::move( known );
+                    return;
+                }
+            }
+            layers.emplace( hash, data );
+            // Layers no submap holds any more are only dropped here, once there are as
+            // many of them as there are layers still in use.
+            if( layers.size() >= 2 * pruned_size() ) {
+                for( auto it = layers.begin(); it != layers.end(); ) {
+                    it = it->second.expired() ? layers.erase( it ) : std::next( it );
+                }
+                pruned_size() = std::max<size_t>( layers.size(), 64 );
+            }
+        }
+
+    private:
+        static size_t content_hash( const array_type &layer ) {
+            size_t hash = 0;
+            for( size_t x = 0; x < array_type::size_x; ++x ) {
+                for( const T &tile : layer[x] ) {
+                    cata::hash_combine( hash, tile );
+                }
+            }
+            return hash;
+        }
+        static bool same_content( const array_type &lhs, const array_type &rhs ) {
+            for( size_t x = 0; x < array_type::size_x; ++x ) {
+                if( lhs[x] != rhs[x] ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        // Weak, so that a layer is freed as soon as the last submap using it lets go.
+        static std::unordered_multimap<size_t, std::weak_ptr<array_type>> &known_layers() {
+            static std::unordered_multimap<size_t, std::weak_ptr<array_type>> layers;
+            return layers;
+        }
+        static size_t &pruned_size() {
+            static size_t size = 64;
+            return size;
+        }
+
+        // Never null.  Not allocated through make_shared, so that the weak references in
+        // known_layers() do not keep the memory of dropped layers around.
+        std::shared_ptr<array_type> data;
+};
+
 // Suppression due to bug in clang-tidy 12
 // NOLINTNEXTLINE(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
 struct maptile_soa {
-    cata::mdarray<ter_id, point_sm_ms>             ter; // Terrain on each square
-    cata::mdarray<furn_id, point_sm_ms>            frn; // Furniture on each square
-    cata::mdarray<std::uint8_t, point_sm_ms>       lum; // Num items emitting light on each square
-    cata::mdarray<cata::colony<item>, point_sm_ms> itm; // Items on each square
-    cata::mdarray<field, point_sm_ms>              fld; // Field on each square
-    cata::mdarray<trap_id, point_sm_ms>            trp; // Trap on each square
-    cata::mdarray<int, point_sm_ms>                rad; // Irradiation of each square
+    explicit maptile_soa( const ter_id &fill_ter );
+
+    shared_soa_layer<ter_id>                       ter; // Terrain on each square
+    shared_soa_layer<furn_id>                      frn; // Furniture on each square
+    shared_soa_layer<std::uint8_t>                 lum; // Num items emitting light on each square
+    // Items and fields make up most of the size of a submap, but most submaps have none.
+    lazy_soa_layer<cata::colony<item>>             itm; // Items on each square
+    lazy_soa_layer<field>                          fld; // Field on each square
+    shared_soa_layer<trap_id>                      trp; // Trap on each square
+    shared_soa_layer<int>                          rad; // Irradiation of each square
 
     void swap_soa_tile( const point_sm_ms &p1, const point_sm_ms &p2 );
+    // Give the memory of layers that ended up empty back
+    void release_empty_layers();
+    // Share the terrain, furniture, light, trap and radiation layers with other submaps
+    // that have the same content in them
+    void share_identical_layers();
 };
 
 class submap
@@ -82,17 +276,46 @@ class submap
 
         void ensure_nonuniform() {
             if( is_uniform() ) {
-                m = std::make_unique<maptile_soa>();
-                std::uninitialized_fill_n( &m->ter[0][0], elements, uniform_ter );
-                std::uninitialized_fill_n( &m->frn[0][0], elements, furn_str_id::NULL_ID() );
-                std::uninitialized_fill_n( &m->lum[0][0], elements, 0 );
-                std::uninitialized_fill_n( &m->trp[0][0], elements, tr_null );
-                std::uninitialized_fill_n( &m->rad[0][0], elements, 0 );
+                m = std::make_unique<maptile_soa>( uniform_ter );
             }
         }
 
         void revert_submap( submap &sr );
 
+        /**
+         * Frees the per-tile item and field storage if nothing is stored there.  Only call
+         * this while nothing holds references into the submap's items or fields.
+         */
+        void release_empty_layers() {
+            if( !is_uniform() ) {
+                m->release_empty_layers();
+            }
+        }
+        /** See maptile_soa::share_identical_layers. */
+        void share_identical_layers() {
+            if( !is_uniform() ) {
+                m->share_identical_layers();
+            }
+        }
+        bool has_item_layer() const {
+            return !is_uniform() && m->itm.is_allocated();
+        }
+        bool has_field_layer() const {
+            return !is_uniform() && m->fld.is_allocated();
+        }
+        // Whether the terrain, furniture, light, trap and radiation layers are all shared
+        // with the other submap.
+        bool shares_layers_with( const submap &other ) const {
+            if( is_uniform() || other.is_uniform() ) {
+                return false;
+            }
+            const maptile_soa &lhs = *m;
+            const maptile_soa &rhs = *other.m;
+            return lhs.ter.shares_with( rhs.ter ) && lhs.frn.shares_with( rhs.frn ) &&
+                   lhs.lum.shares_with( rhs.lum ) && lhs.trp.shares_with( rhs.trp ) &&
+                   lhs.rad.shares_with( rhs.rad );
+        }
+
         submap get_revert_submap() const;
 
         trap_id get_trap( const point_sm_ms &p ) const {
@@ -104,12 +327,12 @@ class submap
 
         void set_trap( const point_sm_ms &p, trap_id trap ) {
             ensure_nonuniform();
-            m->trp[p.x()][p.y()] = trap;
+            m->trp.set( p, trap );
         }
 
         void set_all_traps( const trap_id &trap ) {
             ensure_nonuniform();
-            std::uninitialized_fill_n( &m->trp[0][0], elements, trap );
+            m->trp.fill( trap );
         }
 
         furn_id get_furn( const point_sm_ms &p ) const {
@@ -121,12 +344,12 @@ class submap
 
         void set_furn( const point_sm_ms &p, furn_id furn ) {
             ensure_nonuniform();
-            m->frn[p.x()][p.y()] = furn;
+            m->frn.set( p, furn );
         }
 
         void set_all_furn( const furn_id &furn ) {
             ensure_nonuniform();
-            std::uninitialized_fill_n( &m->frn[0][0], elements, furn );
+            m->frn.fill( furn );
         }
         int get_map_damage( const point_sm_ms &p ) const {
             auto it = ephemeral_data.find( p );
@@ -149,7 +372,7 @@ class submap
 
         void set_ter( const point_sm_ms &p, ter_id terr ) {
             ensure_nonuniform();
-            m->ter[p.x()][p.y()] = terr;
+            m->ter.set( p, terr );
         }
 
         void set_all_ter( const ter_id &terr, bool uniform_ok = false ) {
@@ -159,7 +382,7 @@ class submap
             if( is_uniform() ) {
                 uniform_ter = terr;
             } else {
-                std::uninitialized_fill_n( &m->ter[0][0], elements, terr );
+                m->ter.fill( terr );
             }
         }
 
@@ -172,7 +395,7 @@ class submap
 
         void set_radiation( const point_sm_ms &p, const int radiation ) {
             ensure_nonuniform();
-            m->rad[p.x()][p.y()] = radiation;
+            m->rad.set( p, radiation );
         }
 
         uint8_t get_lum( const point_sm_ms &p ) const {
@@ -184,13 +407,13 @@ class submap
 
         void set_lum( const point_sm_ms &p, uint8_t luminance ) {
             ensure_nonuniform();
-            m->lum[p.x()][p.y()] = luminance;
+            m->lum.set( p, luminance );
         }
 
         void update_lum_add( const point_sm_ms &p, const item &i ) {
             ensure_nonuniform();
             if( i.is_emissive() && m->lum[p.x()][p.y()] < 255 ) {
-                m->lum[p.x()][p.y()]++;
+                m->lum.get_mutable( p.x() )[p.y()]++;
             }
         }
 
@@ -202,7 +425,7 @@ class submap
                 cata::colony<item> static noitems;
                 return noitems;
             }
-            return m->itm[p.x()][p.y()];
+            return m->itm.get_mutable( p.x() )[p.y()];
         }
 
         const cata::colony<item> &get_items( const point_sm_ms &p ) const {
@@ -219,7 +442,7 @@ class submap
                 field static nofield;
                 return nofield;
             }
-            return m->fld[p.x()][p.y()];
+            return m->fld.get_mutable( p.x() )[p.y()];
         }
 
         const field &get_field( const point_sm_ms &p ) const {
@@ -230,8 +453,36 @@ class submap
             return m->fld[p.x()][p.y()];
         }
 
+        // Same as the const get_items and get_field, for looking at a non-const submap
+        // without allocating its item or field layer.
+        const cata::colony<item> &read_items( const point_sm_ms &p ) const {
+            return get_items( p );
+        }
+        const field &read_field( const point_sm_ms &p ) const {
+            return get_field( p );
+        }
+
         void clear_fields( const point_sm_ms &p );
 
+        // Whether the tile at p holds any field entries, dead ones included.
+        bool has_field_tile( const point_sm_ms &p ) const {
+            return field_tiles.test( field_tile_index( p ) );
+        }
+        void set_field_tile( const point_sm_ms &p, bool has_fields ) {
+            field_tiles.set( field_tile_index( p ), has_fields );
+        }
+        // Number of tiles holding field entries.
+        size_t field_tile_count() const {
+            return field_tiles.count();
+        }
+        // Recomputes the tiles holding fields from the field layer, after the layer
+        // was changed wholesale (loading, merging, rotating).
+        void rebuild_field_tiles();
+        // Index of p in the field tile set, in the x-major order tiles are processed in.
+        static constexpr size_t field_tile_index( const point_sm_ms &p ) {
+            return static_cast<size_t>( p.x() * SEEY + p.y() );
+        }
+
         struct cosmetic_t {
             point_sm_ms pos;
             std::string type;
@@ -331,6 +582,9 @@ class submap
         std::map<point_sm_ms, tile_data> ephemeral_data;
         std::map<point_sm_ms, computer> computers;
         std::unique_ptr<maptile_soa> m;
+        // Tiles holding field entries, so field processing and creature_in_field
+        // can skip the rest without touching the field layer.
+        std::bitset<SEEX * SEEY> field_tiles; // NOLINT(cata-serialize)
         ter_id uniform_ter = t_null;
         int temperature_mod = 0; // delta in F
         // Tracks original terrain for tiles transformed by phase logic
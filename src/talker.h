@@ -10,6 +10,7 @@
 #include "type_id.h"
 #include "units.h"
 #include "units_fwd.h"
+#include <cstdint>
 #include <list>
 
 class computer;
@@ -356,6 +357,10 @@ class const_talker
         virtual diag_value const *maybe_get_value( const std::string & ) const {
             return nullptr;
         }
+        // Same as maybe_get_value, looking the variable up by its interned slot if it has one.
+        virtual diag_value const *maybe_get_slot_value( const std::string &key, uint32_t ) const {
+            return maybe_get_value( key );
+        }
 
         // inventory, buying, and selling
         virtual bool is_wearing( const itype_id & ) const {
@@ -579,6 +579,12 @@ diag_value const *talker_character_const::maybe_get_value( const std::string &va
     return me_chr_const->maybe_get_value( var_name );
 }
 
+diag_value const *talker_character_const::maybe_get_slot_value( const std::string &var_name,
+        uint32_t slot ) const
+{
+    return me_chr_const->maybe_get_value( var_name, slot );
+}
+
 void talker_character::set_value( const std::string &var_name, diag_value const &value )
 {
     me_chr->set_value( var_name, value );
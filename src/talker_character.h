@@ -112,6 +112,8 @@ class talker_character_const: virtual public const_talker
         bool is_deaf() const override;
         bool is_mute() const override;
         diag_value const *maybe_get_value( const std::string &var_name ) const override;
+        diag_value const *maybe_get_slot_value( const std::string &var_name,
+                                                uint32_t slot ) const override;
 
         // stats, skills, traits, bionics, magic, and proficiencies
         std::vector<skill_id> skills_teacheable() const override;
@@ -49,6 +49,12 @@ diag_value const *talker_furniture_const::maybe_get_value( const std::string &va
     return me_comp->maybe_get_value( var_name );
 }
 
+diag_value const *talker_furniture_const::maybe_get_slot_value( const std::string &var_name,
+        uint32_t slot ) const
+{
+    return me_comp->maybe_get_value( var_name, slot );
+}
+
 void talker_furniture::set_value( const std::string &var_name, diag_value const &value )
 {
     me_comp->set_value( var_name, value );
@@ -64,6 +64,12 @@ diag_value const *talker_item_const::maybe_get_value( const std::string &var_nam
     return me_it_const->get_item()->maybe_get_value( var_name );
 }
 
+diag_value const *talker_item_const::maybe_get_slot_value( const std::string &var_name,
+        uint32_t slot ) const
+{
+    return me_it_const->get_item()->maybe_get_value( var_name, slot );
+}
+
 bool talker_item_const::has_flag( const flag_id &f ) const
 {
     add_msg_debug( debugmode::DF_TALKER, "Item %s checked for flag %s",
@@ -41,6 +41,8 @@ class talker_item_const: public const_talker_cloner<talker_item_const>
         tripoint_abs_omt pos_abs_omt() const override;
 
         diag_value const *maybe_get_value( const std::string &var_name ) const override;
+        diag_value const *maybe_get_slot_value( const std::string &var_name,
+                                                uint32_t slot ) const override;
 
         bool has_flag( const flag_id &f ) const override;
 
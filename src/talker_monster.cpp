@@ -103,6 +103,12 @@ diag_value const *talker_monster_const::maybe_get_value( const std::string &var_
     return me_mon_const->maybe_get_value( var_name );
 }
 
+diag_value const *talker_monster_const::maybe_get_slot_value( const std::string &var_name,
+        uint32_t slot ) const
+{
+    return me_mon_const->maybe_get_value( var_name, slot );
+}
+
 bool talker_monster_const::has_flag( const flag_id &f ) const
 {
     add_msg_debug( debugmode::DF_TALKER, "Monster %s checked for flag %s", me_mon_const->name(),
@@ -52,6 +52,8 @@ class talker_monster_const: public const_talker_cloner<talker_monster_const>
         effect get_effect( const efftype_id &effect_id, const bodypart_id &bp ) const override;
 
         diag_value const *maybe_get_value( const std::string &var_name ) const override;
+        diag_value const *maybe_get_slot_value( const std::string &var_name,
+                                                uint32_t slot ) const override;
 
         bool has_flag( const flag_id &f ) const override;
         bool has_species( const species_id &species ) const override;
@@ -60,6 +60,12 @@ diag_value const *talker_vehicle_const::maybe_get_value( const std::string &var_
     return me_veh_const->maybe_get_value( var_name );
 }
 
+diag_value const *talker_vehicle_const::maybe_get_slot_value( const std::string &var_name,
+        uint32_t slot ) const
+{
+    return me_veh_const->maybe_get_value( var_name, slot );
+}
+
 void talker_vehicle::set_value( const std::string &var_name, diag_value const &value )
 {
     me_veh->set_value( var_name, value );
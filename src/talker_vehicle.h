@@ -41,6 +41,8 @@ class talker_vehicle_const: public const_talker_cloner<talker_vehicle_const>
         tripoint_abs_omt pos_abs_omt() const override;
 
         diag_value const *maybe_get_value( const std::string &var_name ) const override;
+        diag_value const *maybe_get_slot_value( const std::string &var_name,
+                                                uint32_t slot ) const override;
 
         std::vector<std::string> get_topics( bool radio_contact ) const override;
         bool will_talk_to_u( const Character &you, bool force ) const override;
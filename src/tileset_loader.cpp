@@ -3,11 +3,14 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <optional>
@@ -24,6 +27,7 @@
 #include "cata_assert.h"
 #include "cata_path.h"
 #include "cata_scope_helpers.h"
+#include "cata_thread_pool.h"
 #include "cata_utility.h"
 #include "cuboid_rectangle.h"
 #include "cursesdef.h"
@@ -56,8 +60,81 @@ std::string get_ascii_tile_id( const uint32_t sym, const int FG, const int BG )
                           static_cast<char>( FG ), static_cast<char>( BG )
                         } );
 }
+
+// Width and height from the IHDR chunk of a PNG file, which is all the parse
+// pass needs; decoding the whole image there would double the loading time.
+std::optional<point> read_png_dimensions( const cata_path &path )
+{
+    static constexpr std::array<unsigned char, 8> signature = {
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'
+    };
+    std::array<char, 24> header{};
+    std::ifstream fin( path.get_unrelative_path(), std::ifstream::in | std::ifstream::binary );
+    if( !fin.read( header.data(), header.size() ) ) {
+        return std::nullopt;
+    }
+    for( size_t i = 0; i < signature.size(); ++i ) {
+        if( static_cast<unsigned char>( header[i] ) != signature[i] ) {
+            return std::nullopt;
+        }
+    }
+    if( std::string_view( header.data() + 12, 4 ) != "IHDR" ) {
+        return std::nullopt;
+    }
+    const auto read_u32 = [&]( const size_t at ) {
+        uint32_t value = 0;
+        for( size_t i = at; i < at + 4; ++i ) {
+            value = value << 8 | static_cast<unsigned char>( header[i] );
+        }
+        return static_cast<int>( value );
+    };
+    return point( read_u32( 16 ), read_u32( 20 ) );
+}
 } // namespace
 
+// A color filter resolved on the main thread, so that applying it on a worker
+// neither reads options nor reports errors.
+struct tileset_cache::loader::pixel_filter {
+    color_pixel_function_pointer function = nullptr;
+    // color_pixel_custom looks its colors up in the options for every pixel;
+    // they are captured once here instead.
+    std::optional<color_pixel_custom_params> custom;
+
+    explicit pixel_filter( const std::string &name ) : function( get_color_pixel_function( name ) ) {
+        if( function == static_cast<color_pixel_function_pointer>( color_pixel_custom ) ) {
+            custom = get_color_pixel_custom_params();
+        }
+    }
+
+    explicit operator bool() const {
+        return function != nullptr;
+    }
+
+    SDL_Color operator()( const SDL_Color &color ) const {
+        if( custom ) {
+            return color_pixel_custom( color, *custom );
+        }
+        return function( color );
+    }
+};
+
+// One renderer-sized part of an atlas, ready to be turned into textures.
+struct tileset_cache::loader::prepared_chunk {
+    // Position of the chunk within the atlas.
+    point offset;
+    // 32-bit copy of the chunk, uploaded as the unfiltered variant.
+    SDL_Surface_Ptr normal;
+    // The other variants, in tile_value_targets order after normal. Null where
+    // the filter is color_pixel_none and normal is uploaded instead.
+    std::array<SDL_Surface_Ptr, 5> filtered;
+    std::vector<SDL_Rect> opaque_bounds;
+};
+
+struct tileset_cache::loader::prepared_atlas {
+    int width = 0;
+    std::vector<prepared_chunk> chunks;
+};
+
 static void get_tile_information( const cata_path &config_path, std::string &json_path,
                                   std::string &tileset_path, std::string &layering_path )
 {
@@ -241,13 +318,13 @@ void tileset_cache::loader::copy_surface_to_texture( const SDL_Surface_Ptr &surf
     }
 }
 
-void tileset_cache::loader::create_textures_from_tile_atlas( const SDL_Surface_Ptr &tile_atlas,
-        const point &offset, const tile_value_targets &targets,
-        const atlas_replay_quarantine::gate &abandon_gate )
+tileset_cache::loader::prepared_chunk tileset_cache::loader::prepare_chunk(
+    const SDL_Surface_Ptr &tile_atlas, const point &offset, const atlas_replay_descriptor &desc,
+    const int tile_atlas_width, const std::array<pixel_filter, 5> &filters )
 {
     cata_assert( tile_atlas );
-    cata_assert( targets.normal && targets.shadow && targets.night && targets.overexposed
-                 && targets.memory && targets.silhouette );
+    prepared_chunk chunk;
+    chunk.offset = offset;
 
     // Compute per-sprite opaque bounds once from the unfiltered atlas.
     // Color filter variants preserve the alpha channel, so rescanning is unnecessary.
@@ -255,48 +332,50 @@ void tileset_cache::loader::create_textures_from_tile_atlas( const SDL_Surface_P
     // texture is uploaded from the same 32-bit surface so shader variants sample
     // the same concrete RGBA pixels as the pre-baked variants; paletted fallback
     // atlases are not reliable shader sources on every GPU backend.
-    SDL_Surface_Ptr scan_surf = create_surface_32( tile_atlas->w, tile_atlas->h );
-    throwErrorIf( BlitSurface( tile_atlas, nullptr, scan_surf, nullptr ) != 0,
+    chunk.normal = create_surface_32( tile_atlas->w, tile_atlas->h );
+    throwErrorIf( BlitSurface( tile_atlas, nullptr, chunk.normal, nullptr ) != 0,
                   "SDL_BlitSurface failed" );
 
-    const rect_range<SDL_Rect> scan_range( sprite_width, sprite_height,
-                                           point( tile_atlas->w / sprite_width,
-                                                   tile_atlas->h / sprite_height ) );
+    const rect_range<SDL_Rect> scan_range( desc.sprite_width, desc.sprite_height,
+                                           point( tile_atlas->w / desc.sprite_width,
+                                                   tile_atlas->h / desc.sprite_height ) );
     // Pre-size to accommodate the maximum index this chunk can produce.
-    const int cols = tile_atlas_width / sprite_width;
-    const size_t max_index = this->offset +
-                             static_cast<size_t>( cols ) * ( tile_atlas->h / sprite_height );
-    std::vector<SDL_Rect> opaque_bounds( max_index + cols, SDL_Rect{ 0, 0, 0, 0 } );
+    const int cols = tile_atlas_width / desc.sprite_width;
+    const size_t max_index = desc.atlas_offset +
+                             static_cast<size_t>( cols ) * ( tile_atlas->h / desc.sprite_height );
+    chunk.opaque_bounds.assign( max_index + cols, SDL_Rect{ 0, 0, 0, 0 } );
     for( const SDL_Rect rect : scan_range ) {
         const point pos( offset + point( rect.x, rect.y ) );
-        const size_t index = this->offset + ( pos.x / sprite_width ) + ( pos.y / sprite_height ) *
-                             cols;
-        if( index < opaque_bounds.size() ) {
-            opaque_bounds[index] = compute_opaque_rect( scan_surf, rect );
+        const size_t index = desc.atlas_offset + ( pos.x / desc.sprite_width ) +
+                             ( pos.y / desc.sprite_height ) * cols;
+        if( index < chunk.opaque_bounds.size() ) {
+            chunk.opaque_bounds[index] = compute_opaque_rect( chunk.normal, rect );
         }
     }
 
     /** perform color filter conversion here */
-    using tiles_pixel_color_entry = std::tuple<std::vector<texture>*, std::string>;
-    std::array<tiles_pixel_color_entry, 6> tile_values_data = {{
-            { std::make_tuple( targets.normal, "color_pixel_none" ) },
-            { std::make_tuple( targets.shadow, "color_pixel_grayscale" ) },
-            { std::make_tuple( targets.night, "color_pixel_nightvision" ) },
-            { std::make_tuple( targets.overexposed, "color_pixel_overexposed" ) },
-            { std::make_tuple( targets.memory, memory_map_mode ) },
-            { std::make_tuple( targets.silhouette, "color_pixel_silhouette" ) }
+    for( size_t i = 0; i < filters.size(); ++i ) {
+        if( filters[i] ) {
+            chunk.filtered[i] = apply_color_filter( tile_atlas, filters[i] );
         }
+    }
+    return chunk;
+}
+
+void tileset_cache::loader::upload_chunk( const prepared_chunk &chunk,
+        const tile_value_targets &targets, const atlas_replay_quarantine::gate &abandon_gate )
+{
+    cata_assert( targets.normal && targets.shadow && targets.night && targets.overexposed
+                 && targets.memory && targets.silhouette );
+    const std::array<std::vector<texture> *, 5> filtered_targets = {
+        targets.shadow, targets.night, targets.overexposed, targets.memory, targets.silhouette
     };
-    for( tiles_pixel_color_entry &entry : tile_values_data ) {
-        std::vector<texture> *tile_values = std::get<0>( entry );
-        color_pixel_function_pointer color_pixel_function = get_color_pixel_function( std::get<1>
-                ( entry ) );
-        if( !color_pixel_function ) {
-            copy_surface_to_texture( scan_surf, offset, *tile_values, opaque_bounds, abandon_gate );
-        } else {
-            copy_surface_to_texture( apply_color_filter( tile_atlas, color_pixel_function ), offset,
-                                     *tile_values, opaque_bounds, abandon_gate );
-        }
+    copy_surface_to_texture( chunk.normal, chunk.offset, *targets.normal, chunk.opaque_bounds,
+                             abandon_gate );
+    for( size_t i = 0; i < filtered_targets.size(); ++i ) {
+        const SDL_Surface_Ptr &surf = chunk.filtered[i] ? chunk.filtered[i] : chunk.normal;
+        copy_surface_to_texture( surf, chunk.offset, *filtered_targets[i], chunk.opaque_bounds,
+                                 abandon_gate );
     }
 }
 
@@ -305,12 +384,16 @@ void tileset_cache::loader::read_image_dimensions( const cata_path &img_path,
 {
     cata_assert( sprite_width > 0 );
     cata_assert( sprite_height > 0 );
-    const SDL_Surface_Ptr tile_atlas = load_image( img_path.get_unrelative_path().u8string().c_str() );
-    cata_assert( tile_atlas );
-    tile_atlas_width = tile_atlas->w;
+    std::optional<point> dimensions = read_png_dimensions( img_path );
+    if( !dimensions ) {
+        const SDL_Surface_Ptr tile_atlas = load_image( img_path.get_unrelative_path().u8string().c_str() );
+        cata_assert( tile_atlas );
+        dimensions = point( tile_atlas->w, tile_atlas->h );
+    }
+    tile_atlas_width = dimensions->x;
 
-    const int expected_tilecount = ( tile_atlas->w / sprite_width ) *
-                                   ( tile_atlas->h / sprite_height );
+    const int expected_tilecount = ( dimensions->x / sprite_width ) *
+                                   ( dimensions->y / sprite_height );
 
     atlas_replay_descriptor desc;
     desc.image_path_u8 = img_path.get_unrelative_path().u8string();
@@ -1070,6 +1153,29 @@ atlas_upload_interrupt tileset_cache::loader::upload_atlases( tileset &ts,
     targets.memory = &cand_memory;
     targets.silhouette = &cand_silhouette;
 
+    // Decoding, color keying, filtering and scanning for opaque bounds need no
+    // renderer, so they run on the background workers a few atlases ahead of the
+    // texture uploads done here. The look-ahead is bounded because every prepared
+    // atlas holds all six variants in memory. Jobs still queued when this returns
+    // early finish on their own and their results are dropped.
+    const std::array<pixel_filter, 5> filters = {
+        pixel_filter( "color_pixel_grayscale" ), pixel_filter( "color_pixel_nightvision" ),
+        pixel_filter( "color_pixel_overexposed" ), pixel_filter( memory_map_mode ),
+        pixel_filter( "color_pixel_silhouette" )
+    };
+    const size_t look_ahead = cata::background_workers().size() + 1;
+    std::deque<std::future<prepared_atlas>> preparing;
+    size_t next_to_prepare = 0;
+    const auto prepare_more = [&]() {
+        while( next_to_prepare < descriptors.size() && preparing.size() < look_ahead ) {
+            const atlas_replay_descriptor &desc = descriptors[next_to_prepare++];
+            const point max_tex = max_texture_size( renderer, desc );
+            preparing.push_back( cata::background_workers().submit( [desc, max_tex, filters]() {
+                return prepare_atlas( desc, max_tex, filters );
+            } ) );
+        }
+    };
+
     for( const atlas_replay_descriptor &desc : descriptors ) {
         if( poll ) {
             const atlas_upload_interrupt interrupt = poll();
@@ -1077,8 +1183,18 @@ atlas_upload_interrupt tileset_cache::loader::upload_atlases( tileset &ts,
                 return interrupt;
             }
         }
+        prepare_more();
+        std::future<prepared_atlas> &pending = preparing.front();
+        while( pump_events &&
+               pending.wait_for( std::chrono::milliseconds( 50 ) ) != std::future_status::ready ) {
+            inp_mngr.pump_events();
+        }
+        const prepared_atlas prepared = pending.get();
+        preparing.pop_front();
+        prepare_more();
+
         const atlas_upload_interrupt interrupt =
-            uploader.upload_one_atlas( desc, targets, pump_events, abandon_gate, poll );
+            uploader.upload_one_atlas( desc, prepared, targets, pump_events, abandon_gate, poll );
         if( interrupt != atlas_upload_interrupt::none ) {
             return interrupt;
         }
@@ -1128,25 +1244,12 @@ atlas_upload_interrupt tileset_cache::loader::upload_atlases( tileset &ts,
     return atlas_upload_interrupt::none;
 }
 
-atlas_upload_interrupt tileset_cache::loader::upload_one_atlas( const atlas_replay_descriptor &desc,
-        const tile_value_targets &targets, const bool pump_events,
-        const atlas_replay_quarantine::gate &abandon_gate, const atlas_upload_poll &poll )
+point tileset_cache::loader::max_texture_size( const SDL_Renderer_Ptr &renderer,
+        const atlas_replay_descriptor &desc )
 {
     cata_assert( desc.sprite_width > 0 );
     cata_assert( desc.sprite_height > 0 );
 
-    SDL_Surface_Ptr tile_atlas = load_image( desc.image_path_u8.c_str() );
-    cata_assert( tile_atlas );
-
-    if( desc.color_key_r >= 0 && desc.color_key_r <= 255
-        && desc.color_key_g >= 0 && desc.color_key_g <= 255
-        && desc.color_key_b >= 0 && desc.color_key_b <= 255 ) {
-        const Uint32 key = MapRGB( tile_atlas, 0, 0, 0 );
-        throwErrorIf( SetColorKey( tile_atlas, 1, key ) != 0,
-                      "SDL_SetColorKey failed" );
-        throwErrorIf( SetSurfaceRLE( tile_atlas, 1 ), "SDL_SetSurfaceRLE failed" );
-    }
-
     int max_tex_w = 0;
     int max_tex_h = 0;
     throwErrorIf( !GetRendererMaxTextureSize( renderer, &max_tex_w, &max_tex_h ),
@@ -1186,34 +1289,41 @@ atlas_upload_interrupt tileset_cache::loader::upload_one_atlas( const atlas_repl
         throwErrorIf( max_tex_h < desc.sprite_height,
                       "Maximal texture height is smaller than tile height" );
     }
+    return point( max_tex_w, max_tex_h );
+}
+
+tileset_cache::loader::prepared_atlas tileset_cache::loader::prepare_atlas(
+    const atlas_replay_descriptor &desc, const point &max_tex,
+    const std::array<pixel_filter, 5> &filters )
+{
+    SDL_Surface_Ptr tile_atlas = load_image( desc.image_path_u8.c_str() );
+    cata_assert( tile_atlas );
+
+    if( desc.color_key_r >= 0 && desc.color_key_r <= 255
+        && desc.color_key_g >= 0 && desc.color_key_g <= 255
+        && desc.color_key_b >= 0 && desc.color_key_b <= 255 ) {
+        const Uint32 key = MapRGB( tile_atlas, 0, 0, 0 );
+        throwErrorIf( SetColorKey( tile_atlas, 1, key ) != 0,
+                      "SDL_SetColorKey failed" );
+        throwErrorIf( SetSurfaceRLE( tile_atlas, 1 ), "SDL_SetSurfaceRLE failed" );
+    }
 
     // Number of tiles in each dimension that fits into a (maximal) SDL texture.
     // If the tile atlas contains more than that, we have to split it.
-    const int max_tile_xcount = max_tex_w / desc.sprite_width;
-    const int max_tile_ycount = max_tex_h / desc.sprite_height;
+    const int max_tile_xcount = max_tex.x / desc.sprite_width;
+    const int max_tile_ycount = max_tex.y / desc.sprite_height;
     // Range over the tile atlas, wherein each rectangle fits into the maximal
     // SDL texture size. In other words: a range over the parts into which the
     // tile atlas needs to be split.
     const rect_range<SDL_Rect> output_range(
         max_tile_xcount * desc.sprite_width,
         max_tile_ycount * desc.sprite_height,
-        point( divide_round_up( tile_atlas->w, max_tex_w ),
-               divide_round_up( tile_atlas->h, max_tex_h ) ) );
-
-    // Mirror the per-atlas state that create_textures_from_tile_atlas reads
-    // off the loader instance.
-    sprite_width = desc.sprite_width;
-    sprite_height = desc.sprite_height;
-    offset = desc.atlas_offset;
-    tile_atlas_width = tile_atlas->w;
+        point( divide_round_up( tile_atlas->w, max_tex.x ),
+               divide_round_up( tile_atlas->h, max_tex.y ) ) );
 
+    prepared_atlas prepared;
+    prepared.width = tile_atlas->w;
     for( const SDL_Rect sub_rect : output_range ) {
-        if( poll ) {
-            const atlas_upload_interrupt interrupt = poll();
-            if( interrupt != atlas_upload_interrupt::none ) {
-                return interrupt;
-            }
-        }
         cata_assert( sub_rect.x % desc.sprite_width == 0 );
         cata_assert( sub_rect.y % desc.sprite_height == 0 );
         cata_assert( sub_rect.w % desc.sprite_width == 0 );
@@ -1236,8 +1346,31 @@ atlas_upload_interrupt tileset_cache::loader::upload_one_atlas( const atlas_repl
         const SDL_Surface_Ptr &surf_to_use = smaller_surf ? smaller_surf : tile_atlas;
         cata_assert( surf_to_use );
 
-        create_textures_from_tile_atlas( surf_to_use, point( sub_rect.x, sub_rect.y ), targets,
-                                         abandon_gate );
+        prepared.chunks.push_back( prepare_chunk( surf_to_use, point( sub_rect.x, sub_rect.y ),
+                                   desc, prepared.width, filters ) );
+    }
+    return prepared;
+}
+
+atlas_upload_interrupt tileset_cache::loader::upload_one_atlas( const atlas_replay_descriptor &desc,
+        const prepared_atlas &prepared, const tile_value_targets &targets, const bool pump_events,
+        const atlas_replay_quarantine::gate &abandon_gate, const atlas_upload_poll &poll )
+{
+    // Mirror the per-atlas state that copy_surface_to_texture reads off the
+    // loader instance.
+    sprite_width = desc.sprite_width;
+    sprite_height = desc.sprite_height;
+    offset = desc.atlas_offset;
+    tile_atlas_width = prepared.width;
+
+    for( const prepared_chunk &chunk : prepared.chunks ) {
+        if( poll ) {
+            const atlas_upload_interrupt interrupt = poll();
+            if( interrupt != atlas_upload_interrupt::none ) {
+                return interrupt;
+            }
+        }
+        upload_chunk( chunk, targets, abandon_gate );
 
         if( pump_events ) {
             inp_mngr.pump_events();
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_TILESET_LOADER_H
 #define CATA_SRC_TILESET_LOADER_H
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -62,9 +63,28 @@ class tileset_cache::loader
                                       std::vector<texture> &target,
                                       const std::vector<SDL_Rect> &opaque_bounds,
                                       const atlas_replay_quarantine::gate &abandon_gate );
-        void create_textures_from_tile_atlas( const SDL_Surface_Ptr &tile_atlas, const point &offset,
-                                              const tile_value_targets &targets,
-                                              const atlas_replay_quarantine::gate &abandon_gate );
+
+        // CPU side of an atlas upload. These run on background workers and must
+        // not touch the renderer or the loader; see upload_atlases.
+        struct pixel_filter;
+        struct prepared_chunk;
+        struct prepared_atlas;
+        // Decode the atlas, color-key it and split it into renderer-sized
+        // chunks of at most max_tex pixels.
+        static prepared_atlas prepare_atlas( const atlas_replay_descriptor &desc, const point &max_tex,
+                                             const std::array<pixel_filter, 5> &filters );
+        // Scan the opaque bounds of every sprite in one chunk and apply the
+        // five color filters to it.
+        static prepared_chunk prepare_chunk( const SDL_Surface_Ptr &tile_atlas, const point &offset,
+                                             const atlas_replay_descriptor &desc, int tile_atlas_width,
+                                             const std::array<pixel_filter, 5> &filters );
+        // Largest texture the renderer takes for the atlas, with the software
+        // renderer limited to single sprites. Render thread only.
+        static point max_texture_size( const SDL_Renderer_Ptr &renderer,
+                                       const atlas_replay_descriptor &desc );
+        // Create the six variant textures of a prepared chunk.
+        void upload_chunk( const prepared_chunk &chunk, const tile_value_targets &targets,
+                           const atlas_replay_quarantine::gate &abandon_gate );
 
         void process_variations_after_loading( weighted_int_list<std::vector<int>> &v ) const;
 
@@ -99,11 +119,12 @@ class tileset_cache::loader
         // Load layering data from json.
         void load_layers( const JsonObject &config );
 
-        // Upload one atlas: split into renderer-sized chunks, color-key, emit all
-        // six filter variants, mutating loader sprite-state from the descriptor.
+        // Upload one prepared atlas: create the six filter variant textures of
+        // every chunk, mutating loader sprite-state from the descriptor.
         // Polls before each chunk; on interrupt returns the reason with targets
         // partly filled for the caller to quarantine.
         atlas_upload_interrupt upload_one_atlas( const atlas_replay_descriptor &desc,
+                const prepared_atlas &prepared,
                 const tile_value_targets &targets,
                 bool pump_events,
                 const atlas_replay_quarantine::gate &abandon_gate,
@@ -1,5 +1,7 @@
 #include "ui_manager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iterator>
 #include <optional>
@@ -10,6 +12,7 @@
 #include "cata_imgui.h"
 #include "cata_scope_helpers.h"
 #include "cursesdef.h"
+#include "options.h"
 #include "point.h"
 
 #if defined(EMSCRIPTEN)
@@ -34,6 +37,12 @@ static std::optional<SDL_Rect> prev_clip_rect;
 static uint64_t prev_clip_rect_generation = 0;
 #endif
 static ui_stack_t ui_stack;
+static ui_manager::frame_pacer pacer;
+
+static void record_frame( const std::chrono::steady_clock::time_point &start )
+{
+    pacer.record_frame( start, std::chrono::steady_clock::now() );
+}
 
 ui_adaptor::ui_adaptor() : is_imgui( false ), disabling_uis_below( false ),
     is_debug_message_ui( false ),
@@ -392,6 +401,15 @@ void ui_adaptor::redraw_invalidated( )
     int buf_h = 0;
     get_display_buffer_dims( &buf_w, &buf_h );
 #endif
+    // Nested calls (debug messages) are part of the outer frame.
+    const bool outermost = !redraw_in_progress;
+    const std::chrono::steady_clock::time_point frame_start = std::chrono::steady_clock::now();
+    on_out_of_scope frame_timing( [outermost, frame_start] {
+        if( outermost )
+        {
+            record_frame( frame_start );
+        }
+    } );
     // This boolean is needed when a debug error is thrown inside redraw_invalidated
     if( !imgui_frame_started ) {
 #if defined(TILES)
@@ -600,4 +618,51 @@ void reset()
         adaptor.shutdown();
     }
 }
+
+void frame_pacer::record_frame( const time_point &start, const time_point &end )
+{
+    last_frame_end = end;
+    const std::chrono::microseconds duration =
+        std::chrono::duration_cast<std::chrono::microseconds>( end - start );
+    current_stats.last_frame = duration;
+    current_stats.worst_frame = std::max( current_stats.worst_frame, duration );
+    if( current_stats.frames_drawn == 0 ) {
+        current_stats.average_frame = duration;
+    } else {
+        current_stats.average_frame += ( duration - current_stats.average_frame ) / 16;
+    }
+    current_stats.frames_drawn++;
+}
+
+bool frame_pacer::frame_due( const time_point &now, const int fps )
+{
+    if( fps <= 0 ) {
+        return true;
+    }
+    // Measured from the end of the last frame, so that slow frames leave the
+    // game the same share of time as fast ones.
+    const std::chrono::microseconds interval( 1000000 / fps );
+    if( now - last_frame_end >= interval ) {
+        return true;
+    }
+    current_stats.frames_skipped++;
+    return false;
+}
+
+const frame_stats &get_frame_stats()
+{
+    return pacer.stats();
+}
+
+void reset_frame_stats()
+{
+    pacer.reset_stats();
+}
+
+bool fast_forward_frame_due()
+{
+    return pacer.frame_due( std::chrono::steady_clock::now(),
+                            get_option<int>( "FAST_FORWARD_FPS" ) );
+}
+
 } // namespace ui_manager
@@ -3,6 +3,7 @@
 #define CATA_SRC_UI_MANAGER_H
 
 #include <stddef.h>
+#include <chrono>
 #include <functional>
 #include <memory>
 
@@ -299,6 +300,57 @@ void redraw_invalidated();
 void screen_resized();
 void invalidate_all_ui_adaptors();
 void reset();
+
+/**
+ * Timing of the frames drawn by `redraw` and `redraw_invalidated`, and of the
+ * redraw requests dropped by the fast-forward frame pacing.
+ **/
+struct frame_stats {
+    int frames_drawn = 0;
+    int frames_skipped = 0;
+    std::chrono::microseconds last_frame{ 0 };
+    // Moving average over roughly the last 16 frames.
+    std::chrono::microseconds average_frame{ 0 };
+    std::chrono::microseconds worst_frame{ 0 };
+};
+/**
+ * Keeps the `frame_stats` and decides whether a fast-forward frame is due.
+ * Takes the time from its callers, so that it can be tested without drawing.
+ **/
+class frame_pacer
+{
+    public:
+        using time_point = std::chrono::steady_clock::time_point;
+
+        void record_frame( const time_point &start, const time_point &end );
+        /**
+         * Whether at least one frame interval at @p fps passed between the end of
+         * the last recorded frame and @p now. Counts the request as skipped if not.
+         * @p fps of 0 or less means every request is due.
+         **/
+        bool frame_due( const time_point &now, int fps );
+        const frame_stats &stats() const {
+            return current_stats;
+        }
+        void reset_stats() {
+            current_stats = frame_stats();
+        }
+    private:
+        frame_stats current_stats;
+        time_point last_frame_end;
+};
+const frame_stats &get_frame_stats();
+void reset_frame_stats();
+/**
+ * For the turn loop while the game fast-forwards without waiting for input:
+ * activities, waiting, sleeping, traveling and `QUIT_WATCH`. Returns whether
+ * enough time passed since the last frame to draw another one at the
+ * FAST_FORWARD_FPS option; if not, the request counts as skipped. Callers that
+ * draw on every turn can just drop a skipped frame, the next one shows the
+ * current state anyway. Callers that draw only every so many turns have to
+ * remember that they still owe a frame and ask again on the next turn.
+ **/
+bool fast_forward_frame_due();
 } // namespace ui_manager
 
 #endif // CATA_SRC_UI_MANAGER_H
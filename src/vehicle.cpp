@@ -1225,6 +1225,11 @@ diag_value const *vehicle::maybe_get_value( const std::string &key ) const
     return global_variables::_common_maybe_get_value( key, values );
 }
 
+diag_value const *vehicle::maybe_get_value( const std::string &key, uint32_t slot ) const
+{
+    return global_variables::_common_maybe_get_value( key, slot, values );
+}
+
 void vehicle::clear_values()
 {
     values.clear();
@@ -942,6 +942,7 @@ class vehicle
         void remove_value( const std::string &key );
         diag_value const &get_value( const std::string &key ) const;
         diag_value const *maybe_get_value( const std::string &key ) const;
+        diag_value const *maybe_get_value( const std::string &key, uint32_t slot ) const;
         void clear_values();
         void add_chat_topic( const std::string &topic );
         int get_passenger_count( bool hostile ) const;
@@ -0,0 +1,2 @@
+// NOLINT(cata-header-guard)
+#define VERSION "456d9e9"
@@ -777,6 +777,9 @@ std::list<item> map_cursor::remove_items_with( const
     // fetch the appropriate item stack
     point_sm_ms offset;
     submap *sub = here.get_submap_at( pos_bub(), offset );
+    if( sub->read_items( offset ).empty() ) {
+        return res;
+    }
     cata::colony<item> &stack = sub->get_items( offset );
 
     for( auto iter = stack.begin(); iter != stack.end(); ) {
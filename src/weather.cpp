@@ -16,6 +16,7 @@
 #include "character.h"
 #include "character_attire.h"
 #include "city.h"
+#include "condition.h"
 #include "coordinates.h"
 #include "creature.h"
 #include "debug.h"
@@ -1070,7 +1071,7 @@ void weather_manager::update_weather()
             here.set_seen_cache_dirty( tripoint_bub_ms::zero );
         }
         if( weather_changed ) {
-            effect_on_conditions::process_reactivate();
+            effect_on_conditions::process_reactivate( condition_reads::weather );
         }
     }
     update_snow_depth();
@@ -0,0 +1,39 @@
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <vector>
+
+#include "cata_catch.h"
+#include "cata_thread_pool.h"
+
+TEST_CASE( "parallel_for_calls_every_index_once", "[thread_pool]" )
+{
+    cata::thread_pool pool( 3 );
+    std::vector<std::atomic<int>> calls( 1000 );
+    pool.parallel_for( calls.size(), [&calls]( size_t i ) {
+        ++calls[i];
+    } );
+    for( const std::atomic<int> &c : calls ) {
+        CHECK( c == 1 );
+    }
+}
+
+TEST_CASE( "parallel_for_does_not_wait_behind_busy_workers", "[thread_pool]" )
+{
+    cata::thread_pool pool( 1 );
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::future<void> blocker = pool.submit( [released]() {
+        released.wait();
+    } );
+
+    // The only worker is blocked, so the calling thread has to do all the work.
+    int calls = 0;
+    pool.parallel_for( 10, [&calls]( size_t ) {
+        ++calls;
+    } );
+    CHECK( calls == 10 );
+
+    release.set_value();
+    blocker.wait();
+}
@@ -0,0 +1,105 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "avatar.h"
+#include "cata_catch.h"
+#include "condition.h"
+#include "dialogue.h"
+#include "flexbuffer_json.h"
+#include "json_loader.h"
+#include "npc.h"
+#include "talker.h"
+
+static bool eval_condition( const std::string &json, const_dialogue const &d,
+                            bool default_val = false )
+{
+    JsonObject jo = json_loader::from_string( json );
+    conditional_t::func cond;
+    read_condition( jo, "condition", cond, default_val );
+    return cond( d );
+}
+
+TEST_CASE( "condition_programs_short_circuit_and_fold", "[eoc][condition]" )
+{
+    standard_npc dude;
+    get_avatar().male = true;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+
+    const std::vector<std::pair<std::string, bool>> cases = {
+        { R"({})", false },
+        { R"({ "condition": "u_is_avatar" })", true },
+        { R"({ "condition": "no_such_condition" })", false },
+        { R"({ "condition": { "and": [ ] } })", true },
+        { R"({ "condition": { "or": [ ] } })", false },
+        { R"({ "condition": { "and": [ "u_is_avatar", "npc_is_npc" ] } })", true },
+        { R"({ "condition": { "and": [ "u_is_avatar", "u_is_npc" ] } })", false },
+        { R"({ "condition": { "or": [ "u_is_npc", { "not": "npc_is_npc" } ] } })", false },
+        { R"({ "condition": { "or": [ "u_is_npc", "npc_is_npc" ] } })", true },
+        { R"({ "condition": { "not": { "or": [ "u_is_npc", "u_female" ] } } })", true },
+        {
+            R"({ "condition": { "and": [ "has_alpha", { "or": [ "u_is_npc", "has_beta" ] },
+               { "not": { "and": [ "has_beta", "u_is_npc" ] } } ] } })", true
+        },
+        // Repeated simple conditions share one leaf.
+        {
+            R"({ "condition": { "or": [ { "and": [ "u_is_npc", "has_beta" ] },
+               { "and": [ "u_male", "u_is_npc" ] }, { "and": [ "u_male", "npc_is_npc" ] } ] } })",
+            true
+        },
+        {
+            R"({ "condition": { "and": [ "u_male", { "not": "u_male" } ] } })", false
+        },
+        // Constants decide the list or drop out of it.
+        { R"({ "condition": { "and": [ "u_is_avatar", "no_such_condition" ] } })", false },
+        { R"({ "condition": { "or": [ "u_is_npc", { "not": "no_such_condition" } ] } })", true },
+        { R"({ "condition": { "or": [ "no_such_condition", "u_is_avatar" ] } })", true },
+        { R"({ "condition": { "not": { "and": [ "no_such_condition" ] } } })", true },
+    };
+    for( const std::pair<std::string, bool> &c : cases ) {
+        CAPTURE( c.first );
+        CHECK( eval_condition( c.first, d ) == c.second );
+    }
+    CHECK( eval_condition( R"({})", d, true ) );
+
+    // The same program answers for whichever dialogue it is given.
+    JsonObject jo = json_loader::from_string(
+                        R"({ "condition": { "and": [ "u_is_npc", "npc_is_avatar" ] } })" );
+    conditional_t::func cond;
+    read_condition( jo, "condition", cond, false );
+    dialogue swapped( get_talker_for( &dude ), get_talker_for( get_avatar() ) );
+    CHECK( cond( swapped ) );
+    CHECK_FALSE( cond( d ) );
+    CHECK( cond( swapped ) );
+}
+
+static condition_reads reads_of_condition( const std::string &json )
+{
+    JsonObject jo = json_loader::from_string( json );
+    conditional_t::func cond;
+    condition_reads reads = condition_reads::other;
+    read_condition( jo, "condition", cond, false, reads );
+    return reads;
+}
+
+TEST_CASE( "condition_programs_know_what_they_read", "[eoc][condition]" )
+{
+    CHECK( reads_of_condition( R"({})" ) == condition_reads::nothing );
+    CHECK( reads_of_condition( R"({ "condition": "no_such_condition" })" ) ==
+           condition_reads::nothing );
+    CHECK( reads_of_condition( R"({ "condition": "u_male" })" ) == condition_reads::other );
+    CHECK( reads_of_condition( R"({ "condition": { "not": { "u_has_trait": "GOODHEARING" } } })" ) ==
+           condition_reads::traits );
+    CHECK( reads_of_condition(
+               R"({ "condition": { "u_has_any_trait": [ "GOODHEARING", "BADHEARING" ] } })" ) ==
+           condition_reads::traits );
+    CHECK( reads_of_condition( R"({ "condition": { "or": [ { "u_has_bionics": "bio_power_storage" },
+           { "is_weather": "portal_storm" } ] } })" ) ==
+           ( condition_reads::bionics | condition_reads::weather ) );
+    // A trait taken from a variable also depends on the variable.
+    CHECK( reads_of_condition( R"({ "condition": { "u_has_trait": { "u_val": "trait" } } })" ) ==
+           condition_reads::other );
+    CHECK( reads_of_condition(
+               R"({ "condition": { "and": [ { "u_has_trait": "GOODHEARING" }, "u_male" ] } })" ) ==
+           ( condition_reads::traits | condition_reads::other ) );
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <functional>
@@ -1580,3 +1581,97 @@ TEST_CASE( "EOC_run_eocs", "[eoc]" )
     CHECK( std::isnan( globvars.get_global_value( "nan_val" ).dbl() ) );
     CHECK( globvars.get_global_value( "copied_val" ) == "BLORG" );
 }
+
+TEST_CASE( "queued_eocs_pop_in_time_order", "[eoc]" )
+{
+    const int start = 100000;
+    // Every few turns over a couple of wheel spans, plus far future and overdue entries.
+    std::vector<int> times;
+    for( int i = 0; i < 40; i++ ) {
+        times.push_back( start + ( i * 97 ) % ( queued_eocs::wheel_size * 3 ) + 1 );
+    }
+    times.push_back( start + queued_eocs::wheel_size * queued_eocs::wheel_size * 2 );
+    times.push_back( start + queued_eocs::wheel_size * queued_eocs::wheel_size - 1 );
+    times.push_back( start );
+    times.push_back( 0 );
+
+    queued_eocs queue;
+    queue.has_due( time_point( start ) );
+    for( int t : times ) {
+        queue.push( queued_eoc{ effect_on_condition_EOC_math_test_context, time_point( t ), {} } );
+    }
+
+    std::vector<int> popped;
+    auto pop_until = [&]( int now ) {
+        while( queue.has_due( time_point( now ) ) ) {
+            queued_eocs::storage_iter it = queue.pop_due();
+            const int t = to_turn<int>( it->time );
+            CHECK( t <= now );
+            popped.push_back( t );
+            queue.erase( it );
+        }
+    };
+    // Turn by turn through the wheel, then in one jump.
+    for( int now = start; now < start + queued_eocs::wheel_size * 4; now++ ) {
+        pop_until( now );
+    }
+    pop_until( start + queued_eocs::wheel_size * queued_eocs::wheel_size * 3 );
+
+    std::sort( times.begin(), times.end() );
+    CHECK( popped == times );
+    CHECK( queue.empty() );
+
+    SECTION( "requeued entries come back at their new time" ) {
+        queue.push( queued_eoc{ effect_on_condition_EOC_math_test_context, time_point( start ),
+                                {} } );
+        const int now = start + queued_eocs::wheel_size * queued_eocs::wheel_size * 3;
+        REQUIRE( queue.has_due( time_point( now ) ) );
+        queued_eocs::storage_iter it = queue.pop_due();
+        it->time = time_point( now + 5 );
+        queue.requeue( it );
+        CHECK_FALSE( queue.has_due( time_point( now + 4 ) ) );
+        CHECK( queue.has_due( time_point( now + 5 ) ) );
+
+        queued_eocs copy = queue;
+        CHECK( copy.has_due( time_point( now + 5 ) ) );
+    }
+}
+
+TEST_CASE( "queued_eocs_follow_time_going_back", "[eoc]" )
+{
+    const int start = 100000;
+    const int last = start + queued_eocs::wheel_size * 2;
+    // How far ahead time goes before it comes back: within the first level of the wheel, and far
+    // enough that the wheel jumps.
+    const int far = GENERATE( 20, queued_eocs::wheel_size * 3 );
+    CAPTURE( far );
+
+    queued_eocs queue;
+    queue.has_due( time_point( start ) );
+    for( const int t : std::vector<int> { start + 3, start + 10, last } ) {
+        queue.push( queued_eoc{ effect_on_condition_EOC_math_test_context, time_point( t ), {} } );
+    }
+
+    std::vector<int> popped;
+    auto pop_until = [&]( int now ) {
+        while( queue.has_due( time_point( now ) ) ) {
+            queued_eocs::storage_iter it = queue.pop_due();
+            const int t = to_turn<int>( it->time );
+            CHECK( t <= now );
+            popped.push_back( t );
+            queue.erase( it );
+        }
+    };
+
+    // Entries become due, but time goes back before they are popped. They wait for their turn
+    // again.
+    REQUIRE( queue.has_due( time_point( start + far ) ) );
+    for( int now = start - 5; now <= start + far; now++ ) {
+        pop_until( now );
+    }
+    std::vector<int> expected = { start + 3, start + 10 };
+    if( start + far >= last ) {
+        expected.push_back( last );
+    }
+    CHECK( popped == expected );
+}
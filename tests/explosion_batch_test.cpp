@@ -0,0 +1,130 @@
+#include <cstdio>
+#include <vector>
+
+#include "cata_catch.h"
+#include "character.h"
+#include "coordinates.h"
+#include "explosion.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_helpers_tests.h"
+#include "monster.h"
+#include "player_helpers.h"
+#include "point.h"
+
+// A bare blast, strong enough to kill a zombie next to it.
+static explosion_data test_blast()
+{
+    explosion_data ex;
+    ex.power = 900.0f;
+    ex.distance_factor = 0.8f;
+    return ex;
+}
+
+TEST_CASE( "simultaneous_explosions_all_go_off", "[explosion]" )
+{
+    clear_map_and_put_player_underground();
+    const std::vector<tripoint_bub_ms> centers = { { 30, 30, 0 }, { 60, 30, 0 }, { 90, 90, 0 } };
+    std::vector<monster *> victims;
+    for( const tripoint_bub_ms &p : centers ) {
+        monster &victim = spawn_test_monster( "mon_zombie", p + point::east );
+        victim.no_extra_death_drops = true;
+        victims.push_back( &victim );
+        explosion_handler::explosion( nullptr, p, test_blast() );
+    }
+    // A second identical explosive on the first tile, going off alongside the first one.
+    explosion_handler::explosion( nullptr, centers[0], test_blast() );
+    explosion_handler::process_explosions();
+
+    for( const monster *victim : victims ) {
+        CHECK( victim->is_dead_state() );
+    }
+}
+
+TEST_CASE( "identical_explosions_on_one_tile_stay_separate", "[explosion]" )
+{
+    clear_map_and_put_player_underground();
+    clear_avatar();
+    map &here = get_map();
+    Character &you = get_player_character();
+    const tripoint_bub_ms center( 60, 60, 0 );
+    you.setpos( here, center + point::east );
+    const int hp_before = you.get_hp();
+
+    // At its center this blast has a force of 0.95, too weak to spread to the next tile. Two
+    // of them merged into one explosion with the summed power would reach the player with a
+    // force of about 1.7.
+    explosion_data ex;
+    ex.power = 0.95f * 15.0f;
+    ex.distance_factor = 0.9f;
+    explosion_handler::explosion( nullptr, center, ex );
+    explosion_handler::explosion( nullptr, center, ex );
+    explosion_handler::process_explosions();
+
+    CHECK( you.get_hp() == hp_before );
+}
+
+// A blast with a force of 1.5 at its center and 0.75 on the next tile. One alone is too weak
+// to hurt anything next to it, two of them on either side of a tile add up to a force of 1.5.
+static explosion_data weak_blast()
+{
+    explosion_data ex;
+    ex.power = 1.5f * 15.0f;
+    ex.distance_factor = 0.5f;
+    return ex;
+}
+
+TEST_CASE( "batched_blasts_add_up_on_shared_tiles", "[explosion]" )
+{
+    clear_map_and_put_player_underground();
+    const tripoint_bub_ms target( 60, 60, 0 );
+    monster &victim = spawn_test_monster( "mon_zombie", target );
+    victim.no_extra_death_drops = true;
+    const int hp_before = victim.get_hp();
+    const tripoint_bub_ms west = target + point::west;
+    const tripoint_bub_ms east = target + point::east;
+    // Too close to the edge of the reality bubble, so it goes off on a map of its own.
+    const tripoint_bub_ms edge( 0, 60, 0 );
+
+    SECTION( "blasts going off together hurt" ) {
+        explosion_handler::explosion( nullptr, west, weak_blast() );
+        explosion_handler::explosion( nullptr, east, weak_blast() );
+        explosion_handler::explosion( nullptr, edge, weak_blast() );
+        explosion_handler::process_explosions();
+        CHECK( victim.get_hp() < hp_before );
+    }
+    SECTION( "an explosion on its own map in between splits the batch" ) {
+        explosion_handler::explosion( nullptr, west, weak_blast() );
+        explosion_handler::explosion( nullptr, edge, weak_blast() );
+        explosion_handler::explosion( nullptr, east, weak_blast() );
+        explosion_handler::process_explosions();
+        CHECK( victim.get_hp() == hp_before );
+    }
+}
+
+// A chain reaction in the middle of the reality bubble: a grid of fragmenting
+// explosives going off in the same turn. Run with
+//     cata_test "[explosion][benchmark]"
+TEST_CASE( "chain_reaction_benchmark", "[.][explosion][benchmark]" )
+{
+    clear_map_and_put_player_underground();
+    explosion_data ex = test_blast();
+    ex.shrapnel.casing_mass = 200;
+    ex.shrapnel.fragment_mass = 0.08f;
+
+    std::vector<tripoint_bub_ms> centers;
+    for( int x = 50; x < 80; x += 3 ) {
+        for( int y = 50; y < 80; y += 3 ) {
+            centers.emplace_back( x, y, 0 );
+        }
+    }
+    printf( "\nchain_reaction_benchmark: %zu explosions\n", centers.size() );
+
+    BENCHMARK( "process_explosions" ) {
+        for( const tripoint_bub_ms &p : centers ) {
+            explosion_handler::explosion( nullptr, p, ex );
+        }
+        explosion_handler::process_explosions();
+        return centers.size();
+    };
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cstdio>
 #include <string>
 #include <vector>
 
@@ -12,12 +14,14 @@
 #include "item.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "map_helpers_tests.h"
 #include "map_iterator.h"
 #include "mapdata.h"
 #include "options_helpers.h"
 #include "player_helpers.h"
 #include "point.h"
 #include "string_formatter.h"
+#include "submap.h"
 #include "type_id.h"
 #include "weather_type.h"
 
@@ -264,6 +268,138 @@ TEST_CASE( "fire_spreading", "[field][!mayfail]" )
     fields_test_cleanup();
 }
 
+TEST_CASE( "submap_field_tiles_follow_fields", "[field]" )
+{
+    fields_test_setup();
+
+    tripoint_bub_ms p{ 33, 33, 0 };
+    map &m = get_map();
+    point_sm_ms l;
+    submap *const sm = map_meddler::unsafe_get_submap_at( p, l );
+    REQUIRE( sm != nullptr );
+    REQUIRE( sm->field_tile_count() == 0 );
+
+    m.add_field( p, fd_acid, 3 );
+    CHECK( sm->has_field_tile( l ) );
+    CHECK( sm->field_tile_count() == 1 );
+
+    SECTION( "removed field is dropped when fields are processed" ) {
+        m.remove_field( p, fd_acid );
+        CHECK( sm->has_field_tile( l ) );
+        calendar::turn += 1_turns;
+        m.process_fields();
+        CHECK_FALSE( sm->has_field_tile( l ) );
+    }
+    SECTION( "deleted field is dropped at once" ) {
+        m.delete_field( p, fd_acid );
+        CHECK_FALSE( sm->has_field_tile( l ) );
+    }
+    SECTION( "rotating the submap moves the tile" ) {
+        sm->rotate( 1 );
+        CHECK( sm->field_tile_count() == 1 );
+        CHECK( sm->has_field_tile( l.rotate( 1, { SEEX, SEEY } ) ) );
+    }
+
+    fields_test_cleanup();
+}
+
+TEST_CASE( "gas_that_cannot_spread_returns_to_its_tile", "[field]" )
+{
+    fields_test_setup();
+
+    map &m = get_map();
+    const tripoint_bub_ms src{ 0, 33, 0 };
+    m.add_field( src, fd_smoke, 1 );
+
+    SECTION( "gas merging in bounds leaves its tile" ) {
+        const tripoint_bub_ms dst = src + tripoint::east;
+        map_meddler::gas_spread_to( src, dst, fd_smoke );
+        CHECK_FALSE( m.get_field( src, fd_smoke ) );
+        REQUIRE( m.get_field( dst, fd_smoke ) );
+        CHECK( m.get_field_intensity( dst, fd_smoke ) == 1 );
+    }
+    SECTION( "gas spreading off the map comes back after its source died" ) {
+        // Spreading the last intensity kills the source before the spread is applied.
+        map_meddler::gas_spread_to( src, src + tripoint::west, fd_smoke );
+        REQUIRE( m.get_field( src, fd_smoke ) );
+        CHECK( m.get_field_intensity( src, fd_smoke ) == 1 );
+    }
+
+    fields_test_cleanup();
+}
+
+// Fields read their neighbours as they were when the step began, so a fire can
+// reach at most one tile further per call to process_fields.
+TEST_CASE( "fire_spreads_one_tile_per_step", "[field]" )
+{
+    fields_test_setup();
+    scoped_weather_override weather_clear( WEATHER_CLEAR );
+    weather_clear.with_windspeed( 0 );
+
+    const tripoint_bub_ms p{ 33, 33, 0 };
+    map &m = get_map();
+    for( const tripoint_bub_ms &t : m.points_in_radius( p, 10 ) ) {
+        m.ter_set( t, ter_t_tree_walnut );
+    }
+    m.add_field( p, fd_fire, 3 );
+
+    const auto fire_radius = [&m, &p]() {
+        int radius = 0;
+        for( const tripoint_bub_ms &t : m.points_in_radius( p, 10 ) ) {
+            if( m.get_field( t, fd_fire ) ) {
+                radius = std::max( radius, square_dist( p, t ) );
+            }
+        }
+        return radius;
+    };
+
+    int last_radius = fire_radius();
+    REQUIRE( last_radius == 0 );
+    for( int turn = 0; turn < to_turns<int>( 10_minutes ) && last_radius < 10; turn++ ) {
+        calendar::turn += 1_turns;
+        m.process_fields();
+        const int radius = fire_radius();
+        CAPTURE( turn );
+        CHECK( radius <= last_radius + 1 );
+        last_radius = radius;
+    }
+
+    fields_test_cleanup();
+}
+
+// A walnut forest covering the reality bubble, set alight in the middle and
+// left to burn. Run with
+//     cata_test "[field][benchmark]"
+TEST_CASE( "forest_fire_benchmark", "[.][field][benchmark]" )
+{
+    fields_test_setup();
+    scoped_weather_override weather_clear( WEATHER_CLEAR );
+    weather_clear.with_windspeed( 0 );
+
+    map &m = get_map();
+    for( const tripoint_bub_ms &t : m.points_on_zlevel( 0 ) ) {
+        m.ter_set( t, ter_t_tree_walnut );
+    }
+    const tripoint_bub_ms center{ MAPSIZE_X / 2, MAPSIZE_Y / 2, 0 };
+    for( const tripoint_bub_ms &t : m.points_in_radius( center, 3 ) ) {
+        m.add_field( t, fd_fire, 3 );
+    }
+    // Let the fire grow into a front before measuring.
+    for( int turn = 0; turn < to_turns<int>( 5_minutes ); turn++ ) {
+        calendar::turn += 1_turns;
+        m.process_fields();
+    }
+    printf( "\nforest_fire_benchmark: %d burning tiles\n", count_fields( fd_fire ) );
+
+    BENCHMARK( "process_fields, burning forest" ) {
+        calendar::turn += 1_turns;
+        m.process_fields();
+        return count_fields( fd_fire );
+    };
+
+    fields_test_cleanup();
+}
+
 // tests fd_fire_vent <-> fd_flame_burst cycle
 TEST_CASE( "fd_fire_and_fd_fire_vent_test", "[field]" )
 {
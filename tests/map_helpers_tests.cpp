@@ -9,6 +9,7 @@
 #include "character_attire.h"
 #include "coordinates.h"
 #include "creature_tracker.h"
+#include "field.h"
 #include "game.h"
 #include "item.h"
 #include "map.h"
@@ -151,3 +152,13 @@ submap *map_meddler::unsafe_get_submap_at( tripoint_bub_ms &p, point_sm_ms &l )
 {
     return get_map().unsafe_get_submap_at( p, l );
 }
+
+void map_meddler::gas_spread_to( const tripoint_bub_ms &src, const tripoint_bub_ms &dst,
+                                 const field_type_id &type )
+{
+    map &here = get_map();
+    field_entry *cur = here.get_field( src, type );
+    REQUIRE( cur != nullptr );
+    here.gas_spread_to( *cur, src, dst );
+    here.apply_field_spreads();
+}
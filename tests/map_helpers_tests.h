@@ -26,6 +26,9 @@ class map_meddler
     public:
         static bool has_altered_submaps( map &m );
         static submap *unsafe_get_submap_at( tripoint_bub_ms &p, point_sm_ms &l );
+        // Spreads one intensity of the field at src to dst and applies the queued spread.
+        static void gas_spread_to( const tripoint_bub_ms &src, const tripoint_bub_ms &dst,
+                                   const field_type_id &type );
 };
 
 #endif // CATA_TESTS_MAP_HELPERS_H
@@ -5,10 +5,13 @@
 
 #include "cata_catch.h"
 #include "coordinates.h"
+#include "json.h"
+#include "json_loader.h"
 #include "lru_cache.h"
 #include "map.h"
 #include "map_memory.h"
 #include "map_scale_constants.h"
+#include "memory_fast.h"
 #include "point.h"
 
 static constexpr tripoint_abs_ms p1{ -SEEX - 2, -SEEY - 3, -1 };
@@ -122,7 +125,99 @@ TEST_CASE( "map_memory_forgets", "[map_memory]" )
     CHECK( mt.get_dec_rotation() == 0 );
 }
 
-// TODO: map memory save / load
+static std::string region_to_json( const mm_region &reg )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    reg.serialize( jsout );
+    return os.str();
+}
+
+static mm_region region_from_json( const std::string &json )
+{
+    mm_region reg;
+    reg.deserialize( json_loader::from_string( json ) );
+    return reg;
+}
+
+TEST_CASE( "map_memory_region_round_trip", "[map_memory]" )
+{
+    mm_region reg;
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            reg.submaps[x][y] = make_shared_fast<mm_submap>();
+        }
+    }
+    memorized_tile wall;
+    wall.set_ter_id( "t_wall" );
+    wall.set_ter_subtile( 3 );
+    wall.set_ter_rotation( -1 );
+    wall.symbol = '#';
+    memorized_tile chair;
+    chair.set_ter_id( "t_floor" );
+    chair.set_dec_id( "f_chair" );
+    chair.set_dec_subtile( 2 );
+    chair.set_dec_rotation( 3 );
+    chair.symbol = '#';
+    for( int x = 0; x < SEEX; x++ ) {
+        reg.submaps[0][0]->set_tile( point_sm_ms( x, 0 ), wall );
+        reg.submaps[1][2]->set_tile( point_sm_ms( x, 5 ), x % 2 == 0 ? wall : chair );
+    }
+
+    const std::string json = region_to_json( reg );
+    // Every id is written once into the palette no matter how many tiles use it.
+    REQUIRE( json.find( "\"t_wall\"" ) != std::string::npos );
+    REQUIRE( json.find( "\"f_chair\"" ) != std::string::npos );
+    CHECK( json.find( "\"t_wall\"" ) == json.rfind( "\"t_wall\"" ) );
+    CHECK( json.find( "\"f_chair\"" ) == json.rfind( "\"f_chair\"" ) );
+
+    const mm_region loaded = region_from_json( json );
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            CAPTURE( x, y );
+            CHECK( loaded.submaps[x][y]->is_empty() == reg.submaps[x][y]->is_empty() );
+            for( int ty = 0; ty < SEEY; ty++ ) {
+                for( int tx = 0; tx < SEEX; tx++ ) {
+                    const point_sm_ms p( tx, ty );
+                    CHECK( loaded.submaps[x][y]->get_tile( p ) == reg.submaps[x][y]->get_tile( p ) );
+                }
+            }
+        }
+    }
+    CHECK( loaded.submaps[1][2]->get_tile( point_sm_ms( 1, 5 ) ).get_dec_id() == "f_chair" );
+    CHECK( loaded.submaps[0][0]->get_tile( point_sm_ms( 0, 0 ) ).get_ter_rotation() == -1 );
+}
+
+TEST_CASE( "map_memory_loads_version_1_regions", "[map_memory]" )
+{
+    // One submap with a single run of plain floor followed by a run of
+    // floor with a chair, then nothing else in the region.
+    std::string json = "{\"version\":1,\"data\":[[[2,46,\"t_floor\",0,0],"
+                       "[" + std::to_string( SEEX * SEEY - 2 ) + ",35,\"t_floor\",1,2,\"f_chair\",3,1]]";
+    for( int i = 1; i < MM_REG_SIZE * MM_REG_SIZE; i++ ) {
+        json += ",null";
+    }
+    json += "]}";
+
+    const mm_region loaded = region_from_json( json );
+    const memorized_tile &first = loaded.submaps[0][0]->get_tile( point_sm_ms( 0, 0 ) );
+    CHECK( first.symbol == '.' );
+    CHECK( first.get_ter_id() == "t_floor" );
+    CHECK( first.get_dec_id().empty() );
+    const memorized_tile &last = loaded.submaps[0][0]->get_tile( point_sm_ms( SEEX - 1, SEEY - 1 ) );
+    CHECK( last.symbol == '#' );
+    CHECK( last.get_ter_subtile() == 1 );
+    CHECK( last.get_ter_rotation() == 2 );
+    CHECK( last.get_dec_id() == "f_chair" );
+    CHECK( last.get_dec_subtile() == 3 );
+    CHECK( last.get_dec_rotation() == 1 );
+    CHECK( loaded.submaps[1][0]->is_empty() );
+
+    // Saving it again writes the current format, which loads back the same.
+    const mm_region migrated = region_from_json( region_to_json( loaded ) );
+    CHECK( migrated.submaps[0][0]->get_tile( point_sm_ms( 0, 0 ) ) == first );
+    CHECK( migrated.submaps[0][0]->get_tile( point_sm_ms( SEEX - 1, SEEY - 1 ) ) == last );
+}
 
 #include <chrono>
 
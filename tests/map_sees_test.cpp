@@ -0,0 +1,137 @@
+#include <vector>
+
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "line.h"
+#include "lru_cache.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "map_scale_constants.h"
+#include "point.h"
+#include "rng.h"
+#include "type_id.h"
+
+static const ter_str_id ter_t_floor( "t_floor" );
+static const ter_str_id ter_t_wall( "t_wall" );
+
+static constexpr int sees_test_range = 30;
+
+// The bresenham walk map::sees does, without any caching.
+static bool reference_sees( const map &here, const tripoint_bub_ms &from,
+                            const tripoint_bub_ms &to )
+{
+    bool visible = true;
+    bresenham( from.xy(), to.xy(), 0, [&]( const point_bub_ms & p ) {
+        if( p == to.xy() ) {
+            return false;
+        }
+        if( !here.is_transparent( { p, to.z() } ) ) {
+            visible = false;
+            return false;
+        }
+        return true;
+    } );
+    return visible;
+}
+
+static int count_sees_mismatches( const map &here, const std::vector<tripoint_bub_ms> &observers )
+{
+    int mismatches = 0;
+    for( const tripoint_bub_ms &from : observers ) {
+        for( const tripoint_bub_ms &to : here.points_in_radius( from, sees_test_range ) ) {
+            const bool expected = reference_sees( here, from, to );
+            // Twice, so the second query is served from the observer's sight field.
+            mismatches += here.sees( from, to, sees_test_range ) != expected;
+            mismatches += here.sees( from, to, sees_test_range ) != expected;
+        }
+    }
+    return mismatches;
+}
+
+TEST_CASE( "map_sees_matches_bresenham", "[map][vision]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint_bub_ms center( 60, 60, 0 );
+    for( const tripoint_bub_ms &p : here.points_in_radius( center, sees_test_range + 10 ) ) {
+        if( one_in( 6 ) ) {
+            here.ter_set( p, ter_t_wall );
+        }
+    }
+    std::vector<tripoint_bub_ms> observers = { center };
+    for( int i = 0; i < 4; i++ ) {
+        observers.push_back( center + point( rng( -8, 8 ), rng( -8, 8 ) ) );
+    }
+    here.build_map_cache( 0 );
+    CHECK( count_sees_mismatches( here, observers ) == 0 );
+
+    WHEN( "the walls change" ) {
+        for( const tripoint_bub_ms &p : here.points_in_radius( center, sees_test_range ) ) {
+            if( one_in( 4 ) ) {
+                here.ter_set( p, here.ter( p ) == ter_t_wall ? ter_t_floor : ter_t_wall );
+            }
+        }
+        here.build_map_cache( 0 );
+        THEN( "the answers follow them" ) {
+            CHECK( count_sees_mismatches( here, observers ) == 0 );
+        }
+    }
+}
+
+// The symmetric tile pair key the skew cache used before sight fields.
+static point old_sees_cache_key( const tripoint_bub_ms &from, const tripoint_bub_ms &to )
+{
+    const tripoint_bub_ms &min = from < to ? from : to;
+    const tripoint_bub_ms &max = !( from < to ) ? from : to;
+    return point( min.x() << 20 | min.y() << 10 | ( min.z() + OVERMAP_DEPTH ),
+                  max.x() << 20 | max.y() << 10 | ( max.z() + OVERMAP_DEPTH ) );
+}
+
+TEST_CASE( "map_sees_benchmark", "[.][map][vision][benchmark]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint_bub_ms center( 60, 60, 0 );
+    for( const tripoint_bub_ms &p : here.points_in_radius( center, 50 ) ) {
+        if( one_in( 6 ) ) {
+            here.ter_set( p, ter_t_wall );
+        }
+    }
+    here.build_map_cache( 0 );
+    // A busy reality bubble, each observer checking the same targets every turn.
+    std::vector<tripoint_bub_ms> observers;
+    for( int i = 0; i < 300; i++ ) {
+        observers.push_back( center + point( rng( -40, 40 ), rng( -40, 40 ) ) );
+    }
+    std::vector<tripoint_bub_ms> targets;
+    for( int i = 0; i < 20; i++ ) {
+        targets.push_back( center + point( rng( -20, 20 ), rng( -20, 20 ) ) );
+    }
+
+    lru_cache<point, char> skew_cache;
+    BENCHMARK( "old lru_cache of tile pairs" ) {
+        int seen = 0;
+        for( const tripoint_bub_ms &from : observers ) {
+            for( const tripoint_bub_ms &to : targets ) {
+                const point key = old_sees_cache_key( from, to );
+                char cached = skew_cache.get( key, -1 );
+                if( cached == -1 ) {
+                    cached = reference_sees( here, from, to ) ? 1 : 0;
+                    skew_cache.insert( 100000, key, cached );
+                }
+                seen += cached;
+            }
+        }
+        return seen;
+    };
+    BENCHMARK( "sight fields" ) {
+        int seen = 0;
+        for( const tripoint_bub_ms &from : observers ) {
+            for( const tripoint_bub_ms &to : targets ) {
+                seen += here.sees( from, to, 60 );
+            }
+        }
+        return seen;
+    };
+}
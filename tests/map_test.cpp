@@ -41,6 +41,11 @@ static const itype_id itype_bottle_plastic( "bottle_plastic" );
 static const itype_id itype_cookies( "cookies" );
 static const itype_id itype_disinfectant( "disinfectant" );
 
+static const furn_str_id furn_f_chair( "f_chair" );
+
+static const ter_str_id ter_t_dirt( "t_dirt" );
+static const ter_str_id ter_t_floor( "t_floor" );
+
 TEST_CASE( "map_coordinate_conversion_functions" )
 {
     map &here = get_map();
@@ -185,6 +190,63 @@ void map::check_submap_active_item_consistency()
     }
 }
 
+TEST_CASE( "minimap_cache_tracks_changed_tiles", "[map]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint_bub_ms p( 60, 60, 0 );
+    const tripoint_bub_ms neighbour = p + tripoint::east;
+    here.ter_set( p, ter_t_dirt );
+    here.build_map_cache( p.z() );
+    here.update_visibility_cache( p.z() );
+
+    here.minimap_cache_set_dirty( p, false );
+    here.minimap_cache_set_dirty( neighbour, false );
+    REQUIRE_FALSE( here.minimap_cache_is_dirty( p ) );
+
+    SECTION( "terrain change" ) {
+        here.ter_set( p, ter_t_floor );
+        CHECK( here.minimap_cache_is_dirty( p ) );
+    }
+    SECTION( "furniture change" ) {
+        here.furn_set( p, furn_f_chair );
+        CHECK( here.minimap_cache_is_dirty( p ) );
+    }
+    SECTION( "unchanged visibility" ) {
+        here.invalidate_visibility_cache();
+        here.update_visibility_cache( p.z() );
+        CHECK_FALSE( here.minimap_cache_is_dirty( p ) );
+    }
+    CHECK_FALSE( here.minimap_cache_is_dirty( neighbour ) );
+}
+
+TEST_CASE( "looking_at_empty_tiles_does_not_allocate_item_or_field_layers", "[map][submap]" )
+{
+    clear_map();
+    map &here = get_map();
+    tripoint_bub_ms p( 60, 60, 0 );
+    point_sm_ms l;
+    submap *const sm = map_meddler::unsafe_get_submap_at( p, l );
+    REQUIRE( sm != nullptr );
+    REQUIRE_FALSE( sm->is_uniform() );
+    sm->release_empty_layers();
+    REQUIRE_FALSE( sm->has_item_layer() );
+    REQUIRE_FALSE( sm->has_field_layer() );
+
+    map_stack items = here.i_at( p );
+    CHECK( items.empty() );
+    CHECK( here.field_at( p ).field_count() == 0 );
+    CHECK_FALSE( here.has_items( p ) );
+    CHECK_FALSE( sm->has_item_layer() );
+    CHECK_FALSE( sm->has_field_layer() );
+
+    // Inserting through the stack of an empty tile lands on the tile, and the stack sees it.
+    items.insert( item( itype_cookies ) );
+    CHECK( sm->has_item_layer() );
+    CHECK( items.size() == 1 );
+    CHECK( here.i_at( p ).size() == 1 );
+}
+
 TEST_CASE( "place_player_can_safely_move_multiple_submaps" )
 {
     // Regression test for the situation where game::place_player would misuse
@@ -0,0 +1,151 @@
+#include <cstddef>
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "cata_scope_helpers.h"
+#include "coordinates.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_scale_constants.h"
+#include "mapbuffer.h"
+#include "mapgen.h"
+#include "mapgendata.h"
+#include "overmapbuffer.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "rng.h"
+#include "trap.h"
+#include "type_id.h"
+#include "weighted_list.h"
+
+static const nested_mapgen_id nested_mapgen_test_terrain_plan_dismantle(
+    "test_terrain_plan_dismantle" );
+static const nested_mapgen_id nested_mapgen_test_terrain_plan_erase_all(
+    "test_terrain_plan_erase_all" );
+
+static const oter_str_id oter_field( "field" );
+static const oter_str_id oter_test_terrain_plan( "test_terrain_plan" );
+
+class terrain_plan_meddler
+{
+    public:
+        static bool &use_terrain_plan() {
+            return jmapgen_objects::use_terrain_plan;
+        }
+};
+
+namespace
+{
+
+struct tile_contents {
+    ter_id ter;
+    furn_id furn;
+    trap_id trp;
+    std::vector<itype_id> items;
+
+    bool operator==( const tile_contents &rhs ) const {
+        return ter == rhs.ter && furn == rhs.furn && trp == rhs.trp && items == rhs.items;
+    }
+};
+
+void nest_at( map &m, const tripoint_abs_omt &pos, const nested_mapgen_id &id, const point &p )
+{
+    mapgendata md( pos, m, 0.0f, calendar::turn, nullptr );
+    const auto &ptr = nested_mapgens[id].funcs().pick();
+    ( *ptr )->nest( md, tripoint_rel_ms( p.x, p.y, 0 ), "test" );
+}
+
+// Generates the test OMT, then nests the *_BEFORE_PLACING_TERRAIN chunks over its
+// furniture, traps and items, and returns what ended up on every tile.
+std::vector<tile_contents> generate_with_seed( const tripoint_abs_omt &pos, unsigned int seed )
+{
+    MAPBUFFER.clear_outside_reality_bubble();
+    rng_set_engine_seed( seed );
+    {
+        smallmap generated;
+        generated.generate( pos, calendar::turn, true, true );
+    }
+
+    tinymap tm;
+    tm.load( pos, true );
+    map &m = *tm.cast_to_map();
+    nest_at( m, pos, nested_mapgen_test_terrain_plan_dismantle, point( 3, 2 ) );
+    nest_at( m, pos, nested_mapgen_test_terrain_plan_dismantle, point( 8, 2 ) );
+    nest_at( m, pos, nested_mapgen_test_terrain_plan_dismantle, point( 3, 7 ) );
+    nest_at( m, pos, nested_mapgen_test_terrain_plan_erase_all, point( 14, 2 ) );
+    nest_at( m, pos, nested_mapgen_test_terrain_plan_erase_all, point( 8, 7 ) );
+
+    std::vector<tile_contents> tiles;
+    for( int x = 0; x < SEEX * 2; x++ ) {
+        for( int y = 0; y < SEEY * 2; y++ ) {
+            const tripoint_bub_ms p( x, y, 0 );
+            tile_contents &tile = tiles.emplace_back();
+            tile.ter = m.ter( p );
+            tile.furn = m.furn( p );
+            tile.trp = m.tr_at( p ).loadid;
+            for( const item &it : m.i_at( p ) ) {
+                tile.items.push_back( it.typeId() );
+            }
+        }
+    }
+    MAPBUFFER.clear_outside_reality_bubble();
+    return tiles;
+}
+
+} // namespace
+
+TEST_CASE( "mapgen_terrain_plan_matches_placing_each_piece", "[mapgen]" )
+{
+    get_avatar().move_to( tripoint_abs_ms::zero );
+    clear_overmaps();
+    clear_map();
+    clear_avatar();
+
+    const tripoint_abs_omt pos( 50, 50, 0 );
+    for( int dx = -1; dx <= 1; dx++ ) {
+        for( int dy = -1; dy <= 1; dy++ ) {
+            overmap_buffer.ter_set( pos + tripoint( dx, dy, 0 ), oter_field.id() );
+        }
+    }
+    overmap_buffer.ter_set( pos, oter_test_terrain_plan.id() );
+    calendar::turn = calendar::start_of_cataclysm;
+
+    for( const unsigned int seed : {
+             1u, 42424242u, 1234567u, 987654321u
+         } ) {
+        CAPTURE( seed );
+        const std::vector<tile_contents> with_plan = generate_with_seed( pos, seed );
+
+        std::vector<tile_contents> without_plan;
+        {
+            restore_on_out_of_scope restore_plan( terrain_plan_meddler::use_terrain_plan() );
+            terrain_plan_meddler::use_terrain_plan() = false;
+            without_plan = generate_with_seed( pos, seed );
+        }
+
+        REQUIRE( with_plan.size() == without_plan.size() );
+        // Make sure every layer the comparison covers actually has something on it.
+        int furniture = 0;
+        int traps = 0;
+        int items = 0;
+        for( const tile_contents &tile : with_plan ) {
+            furniture += tile.furn != furn_str_id::NULL_ID() ? 1 : 0;
+            traps += tile.trp != tr_null ? 1 : 0;
+            items += static_cast<int>( tile.items.size() );
+        }
+        CHECK( furniture > 0 );
+        CHECK( traps > 0 );
+        CHECK( items > 0 );
+
+        int mismatches = 0;
+        for( size_t i = 0; i < with_plan.size(); ++i ) {
+            if( !( with_plan[i] == without_plan[i] ) ) {
+                mismatches++;
+            }
+        }
+        CHECK( mismatches == 0 );
+    }
+}
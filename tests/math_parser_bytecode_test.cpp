@@ -0,0 +1,174 @@
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "avatar.h"
+#include "cata_catch.h"
+#include "cata_path.h"
+#include "debug.h"
+#include "dialogue.h"
+#include "filesystem.h"
+#include "flexbuffer_json.h"
+#include "global_vars.h"
+#include "json_loader.h"
+#include "math_parser.h"
+#include "math_parser_type.h"
+#include "npc.h"
+#include "path_info.h"
+#include "rng.h"
+#include "talker.h"
+
+static bool same_result( double a, double b )
+{
+    return a == b || ( std::isnan( a ) && std::isnan( b ) );
+}
+
+// Both evaluations from the same rng state, so rng() and rand() agree too.
+static bool program_matches_tree( math_exp const &exp, const_dialogue const &d )
+{
+    rng_set_engine_seed( 1234 );
+    double const tree = exp.eval_tree( d );
+    rng_set_engine_seed( 1234 );
+    double const program = exp.eval( d );
+    CAPTURE( tree, program );
+    return same_result( tree, program );
+}
+
+TEST_CASE( "math_program_matches_tree", "[math_parser]" )
+{
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    get_globals().set_global_value( "x", 7 );
+    get_avatar().set_value( "x", 3 );
+    dude.set_value( "y", -2 );
+
+    const std::vector<std::string> expressions = {
+        "50 + 2 * 3 ^ 2",
+        "-1 ^ 0.5",
+        "1 / 0",
+        "x * x + u_x - n_y",
+        "x > 5 ? u_x : n_y",
+        "0 ? x : 2 ? u_x : n_y",
+        "x < 5 ? 1 : x < 10 ? 2 : 3",
+        "max( x, u_x, n_y, 4 ) + min( 1, 2 ) + abs( n_y )",
+        "clamp( x, 0, 5 ) + floor( 2.5 ) + round( sqrt( x ) )",
+        "rng( 0, x ) + rand( 10 )",
+        "sin( pi / 2 ) + cos( 0 ) + _test_()",
+        "_test_diag_( x, 2 * u_x, '1': n_y )",
+        "!x + !0 + -x % 4",
+        "missing_var + 1",
+    };
+    for( const std::string &expression : expressions ) {
+        CAPTURE( expression );
+        math_exp exp;
+        REQUIRE( exp.parse( expression ) );
+        CHECK( exp.compiled() );
+        CHECK( program_matches_tree( exp, d ) );
+    }
+
+    SECTION( "constant expressions fold" ) {
+        math_exp exp;
+        REQUIRE( exp.parse( "2 * ( 3 + max( 1, 4 ) ) - 1 ? 5 : 6" ) );
+        CHECK( exp.eval( d ) == 5 );
+    }
+
+    SECTION( "assignments" ) {
+        math_exp exp;
+        REQUIRE( exp.parse( "u_z = x * 2 + 1" ) );
+        CHECK( exp.compiled() );
+        exp.eval( d );
+        REQUIRE( exp.parse( "u_z += 3" ) );
+        exp.eval( d );
+        REQUIRE( exp.parse( "u_z" ) );
+        CHECK( exp.eval( d ) == 18 );
+    }
+}
+
+static void collect_math( const JsonValue &jv, std::vector<std::string> &out );
+
+static void collect_math( const JsonObject &jo, std::vector<std::string> &out )
+{
+    jo.allow_omitted_members();
+    for( const JsonMember member : jo ) {
+        if( member.name() == "math" && member.test_array() ) {
+            std::string expression;
+            for( const JsonValue part : member.get_array() ) {
+                if( part.test_string() ) {
+                    expression += ( expression.empty() ? "" : " " ) + part.get_string();
+                }
+            }
+            out.push_back( expression );
+        } else {
+            collect_math( static_cast<const JsonValue &>( member ), out );
+        }
+    }
+}
+
+static void collect_math( const JsonValue &jv, std::vector<std::string> &out )
+{
+    if( jv.test_object() ) {
+        collect_math( jv.get_object(), out );
+    } else if( jv.test_array() ) {
+        for( const JsonValue entry : jv.get_array() ) {
+            collect_math( entry, out );
+        }
+    }
+}
+
+// Every "math" expression in data/json that evaluates cleanly against the
+// avatar and a bystander, run through the compiled program and through the
+// tree. Run with
+//     cata_test "[math_parser][benchmark]"
+TEST_CASE( "math_program_benchmark", "[.][math_parser][benchmark]" )
+{
+    std::vector<std::string> found;
+    for( const cata_path &file : get_files_from_path( ".json", PATH_INFO::jsondir(), true, true ) ) {
+        collect_math( json_loader::from_path( file ), found );
+    }
+
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    std::vector<math_exp> usable;
+    int compiled = 0;
+    int mismatches = 0;
+    for( const std::string &expression : found ) {
+        math_exp exp;
+        bool ok = true;
+        const std::string msg = capture_debugmsg_during( [&]() {
+            try {
+                ok = exp.parse( expression, false ) && exp.get_type() != math_type_t::assign;
+                if( ok ) {
+                    exp.eval( d );
+                }
+            } catch( math::exception const & ) {
+                ok = false;
+            }
+        } );
+        if( !ok || !msg.empty() ) {
+            continue;
+        }
+        compiled += exp.compiled();
+        mismatches += !program_matches_tree( exp, d );
+        usable.push_back( exp );
+    }
+    printf( "\nmath_program_benchmark: %zu expressions found, %zu evaluate cleanly, %d compiled\n",
+            found.size(), usable.size(), compiled );
+    CHECK( mismatches == 0 );
+
+    BENCHMARK( "tree" ) {
+        double sum = 0;
+        for( const math_exp &exp : usable ) {
+            sum += exp.eval_tree( d );
+        }
+        return sum;
+    };
+    BENCHMARK( "program" ) {
+        double sum = 0;
+        for( const math_exp &exp : usable ) {
+            sum += exp.eval( d );
+        }
+        return sum;
+    };
+}
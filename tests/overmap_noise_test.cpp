@@ -1,11 +1,21 @@
+#include <array>
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "cata_catch.h"
 #include "coordinates.h"
+#include "game.h"
 #include "map_scale_constants.h"
+#include "overmap.h"
 #include "overmap_debug.h"
 #include "overmap_noise.h"
+#include "overmapbuffer.h"
 #include "point.h"
+#include "rng.h"
+#include "simplexnoise.h"
+#include "type_id.h"
 
 TEST_CASE( "om_noise_layer_forest_export", "[.]" )
 {
@@ -25,3 +35,192 @@ TEST_CASE( "om_noise_layer_lake_export", "[.]" )
     om_debug::export_raw_noise( "lake-map-raw.pgm", f, OMAPX * 5, OMAPY * 5 );
     om_debug::export_interpreted_noise( "lake-map-interp.pgm", f, OMAPX * 5, OMAPY * 5, 0.25, false );
 }
+
+TEST_CASE( "om_noise_fields_match_noise_layers", "[overmap][noise]" )
+{
+    const unsigned seed = 1920237457;
+    const point_abs_omt base( OMAPX * 3, -OMAPY );
+    const std::shared_ptr<const om_noise::om_noise_fields> fields =
+        om_noise::compute_noise_fields( base, seed );
+    REQUIRE( fields );
+
+    const om_noise::om_noise_layer_forest forest( base, seed );
+    const om_noise::om_noise_layer_floodplain floodplain( base, seed );
+    const om_noise::om_noise_layer_lake lake( base, seed );
+    const om_noise::om_noise_layer_ocean ocean( base, seed );
+    const om_noise::om_noise_layer_lake prefetched_lake( base, seed, &fields->lake );
+
+    for( int x = 0; x < OMAPX; x++ ) {
+        for( int y = 0; y < OMAPY; y++ ) {
+            const point_om_omt p( x, y );
+            CAPTURE( p );
+            CHECK( fields->forest[p] == forest.noise_at( p ) );
+            CHECK( fields->floodplain[p] == floodplain.noise_at( p ) );
+            CHECK( fields->lake[p] == lake.noise_at( p ) );
+            CHECK( fields->ocean[p] == ocean.noise_at( p ) );
+            CHECK( prefetched_lake.noise_at( p ) == lake.noise_at( p ) );
+        }
+    }
+    // Outside of the overmap the precomputed layer falls back to evaluating the noise.
+    for( const point_om_omt &p : {
+             point_om_omt( -3, 10 ), point_om_omt( OMAPX + 2, OMAPY + 4 )
+         } ) {
+        CHECK( prefetched_lake.noise_at( p ) == lake.noise_at( p ) );
+    }
+}
+
+TEST_CASE( "octave_noise_golden_values", "[noise]" )
+{
+    // Overmaps generated by earlier builds must keep lining up with the ones generated now,
+    // so the noise itself must not change. Where the compiler may fuse multiply-adds the last
+    // bits depend on the build, see octave_noise_3d_batch_vectorized.
+    struct golden_point {
+        float octaves;
+        float scale;
+        float x;
+        float y;
+        float z;
+        float expected;
+    };
+    const std::array<golden_point, 6> points = { {
+            { 4, 0.03f, 0, 0, 12345, 0.504508197f },
+            { 4, 0.03f, -171, 533, 12345, 0.676463485f },
+            { 6, 0.07f, 1234, -87, 98765, 0.426793128f },
+            { 4, 0.05f, 720, 721, 98765, 0.382607311f },
+            { 8, 0.002f, -5000, 4321, 237457, 0.488039911f },
+            { 8, 0.002f, 180, -359, 4242, 0.578183353f },
+        }
+    };
+    for( const golden_point &p : points ) {
+        CAPTURE( p.octaves, p.scale, p.x, p.y, p.z );
+        const float scalar = scaled_octave_noise_3d( p.octaves, 0.5f, p.scale, 0, 1, p.x, p.y,
+                             p.z );
+        float batched = 0.0f;
+        scaled_octave_noise_3d_batch( p.octaves, 0.5f, p.scale, 0, 1, &p.x, &p.y, p.z, &batched,
+                                      1 );
+        CHECK( batched == scalar );
+        if( octave_noise_3d_batch_vectorized ) {
+            CHECK( scalar == p.expected );
+        } else {
+            CHECK( scalar == Approx( p.expected ).margin( 0.001 ) );
+        }
+    }
+}
+
+TEST_CASE( "batched_octave_noise_matches_scalar", "[noise]" )
+{
+    // An odd count, so the last group of points is only partially used.
+    constexpr size_t count = 37;
+    std::array<float, count> xs;
+    std::array<float, count> ys;
+    for( size_t i = 0; i < count; ++i ) {
+        xs[i] = -200.0f + 11.0f * i;
+        ys[i] = 173.0f - 9.0f * i;
+    }
+    const float z = 12345;
+    std::array<float, count> batched;
+    scaled_octave_noise_3d_batch( 8, 0.5f, 0.002f, 0, 1, xs.data(), ys.data(), z, batched.data(),
+                                  count );
+    std::array<float, count> batched_fine;
+    scaled_octave_noise_3d_batch( 6, 0.5f, 0.07f, -1, 3, xs.data(), ys.data(), z,
+                                  batched_fine.data(), count );
+    for( size_t i = 0; i < count; ++i ) {
+        CAPTURE( xs[i], ys[i] );
+        CHECK( batched[i] == scaled_octave_noise_3d( 8, 0.5f, 0.002f, 0, 1, xs[i], ys[i], z ) );
+        CHECK( batched_fine[i] ==
+               scaled_octave_noise_3d( 6, 0.5f, 0.07f, -1, 3, xs[i], ys[i], z ) );
+    }
+}
+
+// Generates the overmap at p from a fixed RNG state and returns its terrain on every level.
+static std::vector<oter_id> generate_overmap_terrain( const point_abs_om &p,
+        const std::shared_ptr<const om_noise::om_noise_fields> &prefetched )
+{
+    overmap_buffer.clear();
+    rng_set_engine_seed( 4242424242 );
+    // Heap-allocated because overmap's map_layer arrays overflow the stack.
+    std::unique_ptr<overmap> om = std::make_unique<overmap>( p );
+    if( prefetched ) {
+        om->set_prefetched_noise( prefetched );
+    }
+    om->populate();
+    std::vector<oter_id> terrain;
+    terrain.reserve( static_cast<size_t>( OMAPX ) * OMAPY * OVERMAP_LAYERS );
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                terrain.push_back( om->ter( tripoint_om_omt( x, y, z ) ) );
+            }
+        }
+    }
+    return terrain;
+}
+
+TEST_CASE( "overmap_generated_from_prefetched_noise_is_identical", "[overmap][noise]" )
+{
+    const point_abs_om p( 2, 3 );
+    const std::vector<oter_id> expected = generate_overmap_terrain( p, nullptr );
+    const std::shared_ptr<const om_noise::om_noise_fields> fields =
+        om_noise::compute_noise_fields( project_to<coords::omt>( p ), g->get_seed() );
+    const std::vector<oter_id> prefetched = generate_overmap_terrain( p, fields );
+    overmap_buffer.clear();
+
+    REQUIRE( expected.size() == prefetched.size() );
+    size_t differing = 0;
+    for( size_t i = 0; i < expected.size(); ++i ) {
+        if( expected[i] != prefetched[i] ) {
+            ++differing;
+        }
+    }
+    CHECK( differing == 0 );
+}
+
+TEST_CASE( "overmap_noise_benchmark", "[.][overmap][noise][benchmark]" )
+{
+    const unsigned seed = 1920237457;
+    const point_abs_omt base( OMAPX * 2, OMAPY * 3 );
+
+    BENCHMARK( "noise layers, one OMT at a time" ) {
+        std::unique_ptr<om_noise::om_noise_fields> fields =
+            std::make_unique<om_noise::om_noise_fields>();
+        const om_noise::om_noise_layer_forest forest( base, seed );
+        const om_noise::om_noise_layer_floodplain floodplain( base, seed );
+        const om_noise::om_noise_layer_lake lake( base, seed );
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const point_om_omt p( x, y );
+                fields->forest[p] = forest.noise_at( p );
+                fields->floodplain[p] = floodplain.noise_at( p );
+                fields->lake[p] = lake.noise_at( p );
+            }
+        }
+        return fields;
+    };
+    BENCHMARK( "noise layers, batched" ) {
+        return om_noise::compute_noise_fields( base, seed );
+    };
+    BENCHMARK( "generate one overmap" ) {
+        overmap_buffer.clear();
+        return overmap_buffer.get( point_abs_om( 2, 3 ) ).get_urbanity();
+    };
+    // The main thread's share of generating an overmap whose noise was prefetched, see
+    // overmapbuffer::prefetch_near. Compare against the case above it: the difference is
+    // the part of the stall that prefetching takes off the main thread.
+    BENCHMARK( "populate one overmap" ) {
+        overmap_buffer.clear();
+        // Heap-allocated because overmap's map_layer arrays overflow the stack.
+        std::unique_ptr<overmap> om = std::make_unique<overmap>( point_abs_om( 2, 3 ) );
+        om->populate();
+        return om->get_urbanity();
+    };
+    const std::shared_ptr<const om_noise::om_noise_fields> prefetched =
+        om_noise::compute_noise_fields( base, g->get_seed() );
+    BENCHMARK( "populate one overmap, noise prefetched" ) {
+        overmap_buffer.clear();
+        std::unique_ptr<overmap> om = std::make_unique<overmap>( point_abs_om( 2, 3 ) );
+        om->set_prefetched_noise( prefetched );
+        om->populate();
+        return om->get_urbanity();
+    };
+    overmap_buffer.clear();
+}
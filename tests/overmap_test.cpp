@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "avatar.h"
 #include "calendar.h"
 #include "cata_catch.h"
 #include "city.h"
@@ -29,6 +30,7 @@
 #include "item_factory.h"
 #include "itype.h"
 #include "map.h"
+#include "map_helpers.h"
 #include "map_helpers_tests.h"
 #include "map_iterator.h"
 #include "map_scale_constants.h"
@@ -55,6 +57,8 @@ static const oter_str_id oter_cabin_east( "cabin_east" );
 static const oter_str_id oter_cabin_north( "cabin_north" );
 static const oter_str_id oter_cabin_south( "cabin_south" );
 static const oter_str_id oter_cabin_west( "cabin_west" );
+static const oter_str_id oter_field( "field" );
+static const oter_str_id oter_forest( "forest" );
 
 static const overmap_special_id overmap_special_Cabin( "Cabin" );
 static const overmap_special_id overmap_special_Lab( "Lab" );
@@ -1105,3 +1109,50 @@ TEST_CASE( "overmap_generation_is_deterministic", "[overmap]" )
         }
     }
 }
+
+TEST_CASE( "overmap_symbols_follow_terrain_and_vision_changes", "[overmap]" )
+{
+    clear_overmaps();
+    const tripoint_abs_omt omp = get_avatar().pos_abs_omt() + tripoint( 20, 20, 0 );
+    oter_display_options opts( get_avatar().pos_abs_omt(), 0 );
+    // No overlays, so only the terrain layer is drawn.
+    opts.blink = false;
+    const auto symbol_at = [&opts]( const tripoint_abs_omt & p ) {
+        oter_display_args args( overmap_buffer.seen( p ) );
+        return oter_symbol_and_color( p, args, opts ).first;
+    };
+
+    overmap_buffer.ter_set( omp, oter_field.id() );
+    overmap_buffer.set_seen( omp, om_vision_level::vague );
+    CHECK( symbol_at( omp ) == oter_field->get_symbol( om_vision_level::vague ) );
+
+    overmap_buffer.ter_set( omp, oter_forest.id() );
+    CHECK( symbol_at( omp ) == oter_forest->get_symbol( om_vision_level::vague ) );
+
+    overmap_buffer.set_seen( omp, om_vision_level::full );
+    CHECK( symbol_at( omp ) == oter_forest->get_symbol( om_vision_level::full ) );
+
+    SECTION( "blended tiles follow their neighbours" ) {
+        const std::vector<oter_t> &all = overmap_terrains::get_all();
+        const auto blender = std::find_if( all.begin(), all.end(), []( const oter_t & ter ) {
+            return ter.blends_adjacent( om_vision_level::vague );
+        } );
+        REQUIRE( blender != all.end() );
+        REQUIRE( oter_field->get_symbol( om_vision_level::vague ) !=
+                 oter_forest->get_symbol( om_vision_level::vague ) );
+
+        const tripoint_abs_omt center = omp + tripoint( 10, 0, 0 );
+        for( const tripoint_abs_omt &p : points_in_radius( center, 1 ) ) {
+            overmap_buffer.ter_set( p, p == center ? blender->id.id() : oter_field.id() );
+            overmap_buffer.set_seen( p, om_vision_level::vague );
+        }
+        CHECK( symbol_at( center ) == oter_field->get_symbol( om_vision_level::vague ) );
+
+        for( const tripoint_abs_omt &p : points_in_radius( center, 1 ) ) {
+            if( p != center ) {
+                overmap_buffer.ter_set( p, oter_forest.id() );
+            }
+        }
+        CHECK( symbol_at( center ) == oter_forest->get_symbol( om_vision_level::vague ) );
+    }
+}
@@ -0,0 +1,215 @@
+#if defined(TILES)
+
+#include <chrono>
+#include <cstdio>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "cata_path.h"
+#include "cata_scope_helpers.h"
+#include "cata_tiles.h"
+#include "color.h"
+#include "coordinates.h"
+#include "cursesdef.h"
+#include "field_type.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_helpers_tests.h"
+#include "options.h"
+#include "output.h"
+#include "path_info.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "sdl_renderer_recovery.h"
+#include "type_id.h"
+
+static const field_type_str_id field_fd_blood( "fd_blood" );
+
+static const furn_str_id furn_f_chair( "f_chair" );
+static const furn_str_id furn_f_table( "f_table" );
+
+static const itype_id itype_rock( "rock" );
+
+static const ter_str_id ter_t_floor( "t_floor" );
+static const ter_str_id ter_t_wall( "t_wall" );
+
+// Frames rendered per zoom level and projection.
+static constexpr int render_benchmark_frames = 60;
+// Sidebar width in terminal cells, roughly the default sidebar layout.
+static constexpr int render_benchmark_sidebar_width = 55;
+// Isometric fixture tileset in tests/data, with sprites for the ids the map uses.
+static const char *const render_benchmark_iso_tileset = "render_benchmark_iso";
+
+// A fixed room layout around the avatar: walls every 12 tiles, furniture,
+// scattered items and blood, and a ring of zombies. Daylight, so every tile in
+// view is lit and drawn with all of its layers.
+static void build_render_benchmark_map()
+{
+    clear_map();
+    clear_avatar();
+    set_time_to_day();
+    build_test_map( ter_t_floor.id() );
+
+    map &here = get_map();
+    const tripoint_bub_ms center = get_avatar().pos_bub();
+    for( const tripoint_bub_ms &p : here.points_in_radius( center, 30 ) ) {
+        const point_rel_ms d = ( p - center ).xy();
+        if( d == point_rel_ms::zero ) {
+            continue;
+        }
+        if( ( d.x() % 12 == 0 || d.y() % 12 == 0 ) && ( d.x() + d.y() ) % 5 != 0 ) {
+            here.ter_set( p, ter_t_wall );
+            continue;
+        }
+        if( ( d.x() * 3 + d.y() ) % 9 == 0 ) {
+            here.furn_set( p, d.x() % 2 == 0 ? furn_f_chair : furn_f_table );
+        } else if( ( d.x() * 7 + d.y() * 3 ) % 5 == 0 ) {
+            here.add_item( p, item( itype_rock ) );
+        }
+        if( ( d.x() + d.y() * 5 ) % 11 == 0 ) {
+            here.add_field( p, field_fd_blood, 1 );
+        }
+    }
+    for( int i = 0; i < 24; i++ ) {
+        const point_rel_ms offset( i % 6 * 4 - 10, i / 6 * 4 - 7 );
+        const tripoint_bub_ms p = center + offset;
+        if( here.passable( p ) ) {
+            spawn_test_monster( "mon_zombie", p );
+        }
+    }
+
+    here.invalidate_visibility_cache();
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0 );
+    here.update_visibility_cache( 0 );
+}
+
+static double to_ms( const std::chrono::nanoseconds &ns, const int frames )
+{
+    return frames > 0 ? std::chrono::duration<double, std::milli>( ns ).count() / frames : 0.0;
+}
+
+// Renders the fixture map headless on the SDL software renderer and prints the
+// mean time per frame spent in each phase, for top-down and isometric
+// projection at several zoom levels. Every frame dirties the draw points cache,
+// like the first frame after a turn passes. The renderer batches draws, so most
+// of the pixel work shows up under "present", where the batch is carried out.
+// Run with
+//     cata_test-tiles "[render][benchmark]"
+TEST_CASE( "render_benchmark", "[.][tiles][render][benchmark]" )
+{
+    software_render_fixture fx;
+    if( !fx.available() ) {
+        WARN( "dummy SDL video backend unavailable; skipping" );
+        return;
+    }
+    REQUIRE( renderer_recovery_test_support::setup_fonts() );
+    renderer_recovery_test_support::set_scaling_and_resize_window( 1, 1280, 720 );
+    renderer_coordinator.drain_pending();
+
+    // gfx/ only ships top-down tilesets, so the isometric rows use a fixture one.
+    restore_on_out_of_scope<std::map<std::string, cata_path>> restore_tilesets( TILESETS );
+    TILESETS[render_benchmark_iso_tileset] =
+        PATH_INFO::base_path() / "tests" / "data" / render_benchmark_iso_tileset;
+    tileset_cache own_tilesets;
+    std::unique_ptr<cata_tiles> tiles =
+        renderer_recovery_test_support::make_tile_context( own_tilesets );
+    tiles->load_tileset( render_benchmark_iso_tileset );
+    REQUIRE( tiles->is_valid() );
+    REQUIRE( tiles->is_isometric() );
+    tiles->load_tileset( "ASCIITiles" );
+    REQUIRE( tiles->is_valid() );
+    REQUIRE_FALSE( tiles->is_isometric() );
+
+    build_render_benchmark_map();
+    const tripoint_bub_ms center = get_avatar().pos_bub();
+
+    int buf_w = 0;
+    int buf_h = 0;
+    renderer_recovery_test_support::current_display_buffer_dims( buf_w, buf_h );
+    int win_w = 0;
+    int win_h = 0;
+    int font_w = 0;
+    int font_h = 0;
+    int scaling = 0;
+    int min_term_w = 0;
+    int min_term_h = 0;
+    renderer_recovery_test_support::current_window_metrics( win_w, win_h, font_w, font_h, scaling,
+            min_term_w, min_term_h );
+    const int term_w = buf_w / font_w;
+    const int term_h = buf_h / font_h;
+    REQUIRE( term_w > render_benchmark_sidebar_width );
+    const int map_w = ( term_w - render_benchmark_sidebar_width ) * font_w;
+
+    catacurses::window sidebar = catacurses::newwin( term_h, render_benchmark_sidebar_width,
+                                 point( term_w - render_benchmark_sidebar_width, 0 ) );
+    const std::string sidebar_line( render_benchmark_sidebar_width - 2, 'x' );
+
+    struct projection {
+        const char *name;
+        const char *tileset;
+    };
+    // draw_scale is in sixteenths, as with the zoom option.
+    const std::vector<int> draw_scales = { 8, 16, 32 };
+
+    printf( "\nrender_benchmark: %dx%d display buffer, %d frames per row, mean ms per frame\n",
+            buf_w, buf_h, render_benchmark_frames );
+    printf( "%-9s %5s %8s %8s %8s %8s %8s %8s %8s %8s %8s\n", "mode", "zoom", "prepare",
+            "terrain", "items", "critters", "overlays", "memorize", "ui", "present", "total" );
+    for( const projection &proj : {
+             projection{ "top-down", "ASCIITiles" },
+             projection{ "iso", render_benchmark_iso_tileset }
+         } ) {
+        tiles->load_tileset( proj.tileset );
+        for( const int scale : draw_scales ) {
+            tiles->set_draw_scale( scale );
+            tiles->reset_draw_timings();
+            tiles->set_draw_profiling( true );
+            std::chrono::nanoseconds ui{ 0 };
+            std::chrono::nanoseconds present{ 0 };
+            for( int frame = 0; frame < render_benchmark_frames; frame++ ) {
+                std::multimap<point, formatted_text> overlay_strings;
+                color_block_overlay_container color_blocks;
+                tiles->set_draw_cache_dirty();
+                tiles->draw( point::zero, center, map_w, buf_h, overlay_strings, color_blocks );
+
+                const std::chrono::steady_clock::time_point ui_start =
+                    std::chrono::steady_clock::now();
+                werase( sidebar );
+                for( int y = 1; y < term_h - 1; y++ ) {
+                    mvwprintz( sidebar, point( 1, y ), y % 2 ? c_light_gray : c_yellow,
+                               sidebar_line );
+                }
+                // Draws the sidebar text into the display buffer.
+                wnoutrefresh( sidebar );
+                const std::chrono::steady_clock::time_point present_start =
+                    std::chrono::steady_clock::now();
+                ui += present_start - ui_start;
+
+                renderer_recovery_test_support::present_frame();
+                present += std::chrono::steady_clock::now() - present_start;
+            }
+            tiles->set_draw_profiling( false );
+
+            const cata_tiles::draw_phase_timings &t = tiles->get_draw_timings();
+            CHECK( t.frames == render_benchmark_frames );
+            const std::chrono::nanoseconds total = t.prepare + t.terrain + t.items + t.critters +
+                                                   t.overlays + t.memorize + ui + present;
+            printf( "%-9s %4d%% %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f\n",
+                    proj.name, scale * 100 / 16, to_ms( t.prepare, t.frames ),
+                    to_ms( t.terrain, t.frames ), to_ms( t.items, t.frames ),
+                    to_ms( t.critters, t.frames ), to_ms( t.overlays, t.frames ),
+                    to_ms( t.memorize, t.frames ), to_ms( ui, t.frames ),
+                    to_ms( present, t.frames ), to_ms( total, t.frames ) );
+        }
+    }
+}
+
+#endif // TILES
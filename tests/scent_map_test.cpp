@@ -0,0 +1,151 @@
+#include <memory>
+
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "map_scale_constants.h"
+#include "rng.h"
+#include "scent_map.h"
+
+using scent_grid = scent_map::scent_array<int>;
+using scent_flags = scent_map::scent_array<bool>;
+
+// The scalar diffusion step scent_map::update used before it was vectorized,
+// kept as the reference the kernel must match exactly.
+static void reference_diffuse( scent_grid &grscent, const scent_flags &blocks_scent,
+                               const scent_flags &reduces_scent, const point_bub_ms &center,
+                               const int radius )
+{
+    std::unique_ptr<scent_grid> sum_3_scent_y_ptr = std::make_unique<scent_grid>();
+    std::unique_ptr<scent_grid> squares_used_y_ptr = std::make_unique<scent_grid>();
+    scent_grid &sum_3_scent_y = *sum_3_scent_y_ptr;
+    scent_grid &squares_used_y = *squares_used_y_ptr;
+
+    const int scentmap_minx = center.x() - radius;
+    const int scentmap_maxx = center.x() + radius;
+    const int scentmap_miny = center.y() - radius;
+    const int scentmap_maxy = center.y() + radius;
+    const int diffusivity = 100;
+
+    for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
+        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
+            sum_3_scent_y[y][x] = 0;
+            squares_used_y[y][x] = 0;
+            for( int i = y - 1; i <= y + 1; ++i ) {
+                if( !blocks_scent[x][i] ) {
+                    if( reduces_scent[x][i] ) {
+                        sum_3_scent_y[y][x] += 2 * grscent[x][i];
+                        squares_used_y[y][x] += 2;
+                    } else {
+                        sum_3_scent_y[y][x] += 10 * grscent[x][i];
+                        squares_used_y[y][x] += 10;
+                    }
+                }
+            }
+        }
+    }
+
+    for( int x = scentmap_minx; x <= scentmap_maxx; ++x ) {
+        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
+            int &scent_here = grscent[x][y];
+            if( !blocks_scent[x][y] ) {
+                const int squares_used = squares_used_y[y][x - 1]
+                                         + squares_used_y[y][x]
+                                         + squares_used_y[y][x + 1];
+                const int this_diffusivity = reduces_scent[x][y] ? diffusivity / 5 : diffusivity;
+                int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
+                temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
+                scent_here =
+                    ( temp_scent
+                      + this_diffusivity * ( sum_3_scent_y[y][x - 1]
+                                             + sum_3_scent_y[y][x]
+                                             + sum_3_scent_y[y][x + 1] )
+                    ) / ( 1000 * 10 );
+            } else {
+                scent_here = 0;
+            }
+        }
+    }
+}
+
+// Random scent values with roughly one cell in eight blocking scent and one in
+// four reducing it. Reducing cells may also block, as vehicle parts can make them.
+static void fill_random_scent( scent_grid &scent, scent_flags &blocks, scent_flags &reduces )
+{
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            scent[x][y] = one_in( 3 ) ? 0 : rng( 0, 10000 );
+            blocks[x][y] = one_in( 8 );
+            reduces[x][y] = one_in( 4 );
+        }
+    }
+}
+
+// The weights map::scent_blockers would build from the flags.
+static void fill_weights( scent_grid &weight, const scent_flags &blocks,
+                          const scent_flags &reduces )
+{
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            weight[x][y] = blocks[x][y] ? scent_map::weight_blocked :
+                           reduces[x][y] ? scent_map::weight_reduced : scent_map::weight_open;
+        }
+    }
+}
+
+TEST_CASE( "scent_diffusion_matches_scalar_reference", "[scent][nogame]" )
+{
+    std::unique_ptr<scent_grid> expected = std::make_unique<scent_grid>();
+    std::unique_ptr<scent_grid> actual = std::make_unique<scent_grid>();
+    std::unique_ptr<scent_flags> blocks = std::make_unique<scent_flags>();
+    std::unique_ptr<scent_flags> reduces = std::make_unique<scent_flags>();
+    std::unique_ptr<scent_grid> weight = std::make_unique<scent_grid>();
+    // Shared by every step, as scent_map::update shares its own.
+    std::unique_ptr<scent_map::diffusion_buffers> buffers =
+        std::make_unique<scent_map::diffusion_buffers>();
+
+    const point_bub_ms center = GENERATE(
+                                    point_bub_ms( MAPSIZE_X / 2, MAPSIZE_Y / 2 ),
+                                    point_bub_ms( SCENT_RADIUS + 1, SCENT_RADIUS + 1 ),
+                                    point_bub_ms( MAPSIZE_X - SCENT_RADIUS - 2, MAPSIZE_Y / 3 ) );
+    CAPTURE( center );
+    fill_random_scent( *expected, *blocks, *reduces );
+    fill_weights( *weight, *blocks, *reduces );
+    *actual = *expected;
+
+    // Several steps, so later ones diffuse scent that earlier ones moved around.
+    for( int step = 0; step < 10; ++step ) {
+        reference_diffuse( *expected, *blocks, *reduces, center, SCENT_RADIUS );
+        scent_map::diffuse( *actual, *weight, center, *buffers );
+    }
+    int mismatches = 0;
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            if( ( *expected )[x][y] != ( *actual )[x][y] ) {
+                mismatches++;
+            }
+        }
+    }
+    CHECK( mismatches == 0 );
+}
+
+TEST_CASE( "scent_diffusion_benchmark", "[.][scent][benchmark][nogame]" )
+{
+    std::unique_ptr<scent_grid> scent = std::make_unique<scent_grid>();
+    std::unique_ptr<scent_flags> blocks = std::make_unique<scent_flags>();
+    std::unique_ptr<scent_flags> reduces = std::make_unique<scent_flags>();
+    std::unique_ptr<scent_grid> weight = std::make_unique<scent_grid>();
+    std::unique_ptr<scent_map::diffusion_buffers> buffers =
+        std::make_unique<scent_map::diffusion_buffers>();
+    fill_random_scent( *scent, *blocks, *reduces );
+    fill_weights( *weight, *blocks, *reduces );
+    const point_bub_ms center( MAPSIZE_X / 2, MAPSIZE_Y / 2 );
+
+    BENCHMARK( "scalar reference" ) {
+        reference_diffuse( *scent, *blocks, *reduces, center, SCENT_RADIUS );
+        return ( *scent )[center.x()][center.y()];
+    };
+    BENCHMARK( "scent_map::diffuse" ) {
+        scent_map::diffuse( *scent, *weight, center, *buffers );
+        return ( *scent )[center.x()][center.y()];
+    };
+}
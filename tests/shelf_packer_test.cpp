@@ -0,0 +1,67 @@
+#include <optional>
+#include <vector>
+
+#include "cata_catch.h"
+#include "cuboid_rectangle.h"
+#include "point.h"
+#include "shelf_packer.h"
+
+static bool any_overlap( const std::vector<half_open_rectangle<point>> &rects )
+{
+    for( size_t i = 0; i < rects.size(); ++i ) {
+        for( size_t j = i + 1; j < rects.size(); ++j ) {
+            if( rects[i].overlaps( rects[j] ) ) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+TEST_CASE( "shelf_packer_fills_rows_of_equal_glyphs", "[shelf_packer]" )
+{
+    // 8x16 glyphs with one pixel of padding: 7 per row, 3 rows.
+    shelf_packer packer( 64, 51, 1 );
+    std::vector<half_open_rectangle<point>> placed;
+    for( int i = 0; i < 21; ++i ) {
+        const std::optional<point> p = packer.insert( 8, 16 );
+        REQUIRE( p );
+        CHECK( p->x + 8 <= 64 );
+        CHECK( p->y + 16 <= 51 );
+        placed.emplace_back( *p, *p + point( 9, 17 ) );
+    }
+    CHECK_FALSE( any_overlap( placed ) );
+    CHECK_FALSE( packer.insert( 8, 16 ) );
+
+    packer.reset();
+    CHECK( packer.insert( 8, 16 ) == point::zero );
+}
+
+TEST_CASE( "shelf_packer_mixes_heights_without_overlap", "[shelf_packer]" )
+{
+    shelf_packer packer( 128, 128, 1 );
+    std::vector<half_open_rectangle<point>> placed;
+    const std::vector<point> sizes = { { 8, 16 }, { 16, 16 }, { 8, 12 }, { 30, 20 }, { 8, 16 }, { 5, 5 } };
+    for( int round = 0; round < 10; ++round ) {
+        for( const point &size : sizes ) {
+            const std::optional<point> p = packer.insert( size.x, size.y );
+            if( !p ) {
+                continue;
+            }
+            CHECK( p->x + size.x <= 128 );
+            CHECK( p->y + size.y <= 128 );
+            placed.emplace_back( *p, *p + size );
+        }
+    }
+    CHECK( placed.size() > sizes.size() * 5 );
+    CHECK_FALSE( any_overlap( placed ) );
+}
+
+TEST_CASE( "shelf_packer_rejects_what_cannot_fit", "[shelf_packer]" )
+{
+    shelf_packer packer( 32, 32, 1 );
+    CHECK_FALSE( packer.insert( 40, 8 ) );
+    CHECK_FALSE( packer.insert( 8, 40 ) );
+    CHECK_FALSE( packer.insert( 0, 8 ) );
+    CHECK( packer.insert( 8, 8 ) );
+}
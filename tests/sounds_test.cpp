@@ -0,0 +1,120 @@
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "calendar.h"
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_helpers_tests.h"
+#include "map_scale_constants.h"
+#include "monster.h"
+#include "options_helpers.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "rng.h"
+#include "sound_listener_grid.h"
+#include "sounds.h"
+#include "weather_type.h"
+
+TEST_CASE( "monsters_hear_sounds_only_within_range", "[sounds][monster]" )
+{
+    clear_map();
+    clear_avatar();
+    scoped_weather_override weather( WEATHER_CLEAR );
+    sounds::reset_sounds();
+
+    const tripoint_bub_ms source{ 20, 20, 0 };
+    monster &close_by = spawn_test_monster( "mon_zombie", source + point( 5, 0 ) );
+    monster &across = spawn_test_monster( "mon_zombie", source + point( 0, 60 ) );
+    monster &distant = spawn_test_monster( "mon_zombie", source + point( 90, 90 ) );
+    REQUIRE( close_by.wandf == 0 );
+    REQUIRE( across.wandf == 0 );
+    REQUIRE( distant.wandf == 0 );
+
+    sounds::sound( source, 40, sounds::sound_t::alert, "a test shout" );
+    sounds::process_sounds();
+
+    // Close enough to hear and follow it.
+    CHECK( close_by.wandf > 0 );
+    // Further than the volume, so nothing reaches them.
+    CHECK( across.wandf == 0 );
+    CHECK( distant.wandf == 0 );
+
+    sounds::reset_sounds();
+}
+
+TEST_CASE( "sound_listener_grid_matches_brute_force_scan", "[sounds][monster]" )
+{
+    clear_map();
+    clear_avatar();
+
+    for( int i = 0; i < 300; i++ ) {
+        spawn_test_monster( "mon_zombie", { rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 } );
+    }
+    sound_listener_grid<monster *> grid;
+    for( monster &critter : g->all_monsters() ) {
+        grid.add( critter.pos_bub(), &critter );
+    }
+
+    for( int i = 0; i < 200; i++ ) {
+        // Sources may be off the bubble, like sounds from a neighbouring submap.
+        const tripoint_bub_ms source( rng( -20, MAPSIZE_X + 20 ), rng( -20, MAPSIZE_Y + 20 ), 0 );
+        const int range = rng( 0, 80 );
+        CAPTURE( source, range );
+
+        std::vector<monster *> expected;
+        for( monster &critter : g->all_monsters() ) {
+            const tripoint_bub_ms pos = critter.pos_bub();
+            if( std::abs( pos.x() - source.x() ) <= range &&
+                std::abs( pos.y() - source.y() ) <= range ) {
+                expected.push_back( &critter );
+            }
+        }
+        std::vector<monster *> actual;
+        grid.for_each_in_range( source, range,
+        [&]( const tripoint_bub_ms &, monster * critter ) {
+            actual.push_back( critter );
+        } );
+        CHECK( actual == expected );
+    }
+}
+
+// A horde spread over the reality bubble and a turn's worth of loud combat
+// sounds in several places. Run with
+//     cata_test "[sounds][benchmark]"
+TEST_CASE( "process_sounds_benchmark", "[.][sounds][benchmark]" )
+{
+    clear_map();
+    clear_avatar();
+    scoped_weather_override weather( WEATHER_CLEAR );
+    sounds::reset_sounds();
+
+    int spawned = 0;
+    for( int x = 2; x < MAPSIZE_X - 2; x += 4 ) {
+        for( int y = 2; y < MAPSIZE_Y - 2; y += 4 ) {
+            spawn_test_monster( "mon_zombie", { x, y, 0 } );
+            spawned++;
+        }
+    }
+    std::vector<std::pair<tripoint_bub_ms, int>> turn_sounds;
+    for( int i = 0; i < 200; i++ ) {
+        const tripoint_bub_ms p( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 );
+        turn_sounds.emplace_back( p, rng( 5, 30 ) );
+    }
+    printf( "\nprocess_sounds_benchmark: %d monsters, %zu sounds per turn\n", spawned,
+            turn_sounds.size() );
+
+    BENCHMARK( "process_sounds" ) {
+        for( const std::pair<tripoint_bub_ms, int> &snd : turn_sounds ) {
+            sounds::sound( snd.first, snd.second, sounds::sound_t::combat, "a test noise" );
+        }
+        sounds::process_sounds();
+        return spawned;
+    };
+
+    sounds::reset_sounds();
+}
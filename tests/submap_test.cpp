@@ -1,5 +1,10 @@
+#include <utility>
+
 #include "cata_catch.h"
+#include "colony.h"
 #include "coordinates.h"
+#include "field.h"
+#include "item.h"
 #include "map_scale_constants.h"
 #include "point.h"
 #include "submap.h"
@@ -115,3 +120,96 @@ TEST_CASE( "submap_rotation2", "[submap]" )
         }
     }
 }
+
+TEST_CASE( "submap_releases_only_empty_item_and_field_layers", "[submap]" )
+{
+    const itype_id itype_rock( "rock" );
+    constexpr point_sm_ms corner = { SEEX - 1, 0 };
+    submap sm;
+    sm.set_ter( point_sm_ms::zero, ter_id( 1 ) );
+    REQUIRE_FALSE( sm.is_uniform() );
+
+    // Rotating before anything was placed must not trip over the missing layers.
+    sm.rotate( 1 );
+    sm.release_empty_layers();
+    CHECK( std::as_const( sm ).get_items( corner ).empty() );
+    CHECK( std::as_const( sm ).get_field( corner ).field_count() == 0 );
+    CHECK_FALSE( sm.has_item_layer() );
+    CHECK_FALSE( sm.has_field_layer() );
+
+    sm.get_items( corner ).insert( item( itype_rock ) );
+    CHECK( sm.has_item_layer() );
+    CHECK_FALSE( sm.has_field_layer() );
+    sm.release_empty_layers();
+    REQUIRE( sm.get_items( corner ).size() == 1 );
+
+    sm.rotate( 1 );
+    constexpr point_sm_ms rotated_corner = { SEEX - 1, SEEY - 1 };
+    CHECK( sm.get_items( corner ).empty() );
+    CHECK( sm.get_items( rotated_corner ).size() == 1 );
+
+    sm.get_items( rotated_corner ).clear();
+    sm.release_empty_layers();
+    CHECK( std::as_const( sm ).get_items( rotated_corner ).empty() );
+    CHECK_FALSE( sm.has_item_layer() );
+    CHECK( sm.get_ter( rotated_corner ) == ter_id( 1 ) );
+
+    // Copies and revert submaps only read the layers.
+    submap copy = sm.get_revert_submap();
+    CHECK_FALSE( copy.has_item_layer() );
+    CHECK_FALSE( copy.has_field_layer() );
+}
+
+TEST_CASE( "submap_layers_are_shared_until_written", "[submap]" )
+{
+    constexpr point_sm_ms corner = { SEEX - 1, SEEY - 1 };
+    submap a;
+    submap b;
+    a.set_ter( point_sm_ms::zero, ter_id( 1 ) );
+    b.set_ter( point_sm_ms::zero, ter_id( 1 ) );
+    REQUIRE_FALSE( a.shares_layers_with( b ) );
+    a.share_identical_layers();
+    b.share_identical_layers();
+    CHECK( a.shares_layers_with( b ) );
+
+    // Writing what is already there keeps the layers shared.
+    b.set_radiation( corner, 0 );
+    b.set_ter( point_sm_ms::zero, ter_id( 1 ) );
+    CHECK( b.shares_layers_with( a ) );
+
+    b.set_ter( corner, ter_id( 2 ) );
+    CHECK_FALSE( b.shares_layers_with( a ) );
+    CHECK( b.get_ter( corner ) == ter_id( 2 ) );
+    CHECK( a.get_ter( corner ) != ter_id( 2 ) );
+    CHECK( a.get_ter( point_sm_ms::zero ) == ter_id( 1 ) );
+
+    // Revert submaps share the layers of the submap they were taken from.
+    submap revert = b.get_revert_submap();
+    CHECK( revert.shares_layers_with( b ) );
+    b.set_radiation( corner, 5 );
+    CHECK( revert.get_radiation( corner ) == 0 );
+    CHECK( b.get_radiation( corner ) == 5 );
+
+    b.revert_submap( revert );
+    CHECK( b.get_ter( corner ) == ter_id( 2 ) );
+}
+
+TEST_CASE( "submap_revert_restores_items_and_terrain", "[submap]" )
+{
+    const itype_id itype_rock( "rock" );
+    submap sm;
+    sm.set_ter( point_sm_ms::zero, ter_id( 1 ) );
+    sm.get_items( point_sm_ms::zero ).insert( item( itype_rock ) );
+    submap with_rock = sm.get_revert_submap();
+
+    submap without_items;
+    without_items.set_ter( point_sm_ms::zero, ter_id( 2 ) );
+    sm.revert_submap( without_items );
+    CHECK( sm.get_ter( point_sm_ms::zero ) == ter_id( 2 ) );
+    CHECK( std::as_const( sm ).get_items( point_sm_ms::zero ).empty() );
+    CHECK( std::as_const( without_items ).get_items( point_sm_ms::zero ).empty() );
+
+    sm.revert_submap( with_rock );
+    CHECK( sm.get_ter( point_sm_ms::zero ) == ter_id( 1 ) );
+    CHECK( std::as_const( sm ).get_items( point_sm_ms::zero ).size() == 1 );
+}
@@ -0,0 +1,69 @@
+#include <chrono>
+
+#include "cata_catch.h"
+#include "options_helpers.h"
+#include "ui_manager.h"
+
+using namespace std::chrono_literals;
+
+TEST_CASE( "fast_forward_frames_are_due_one_interval_after_the_last_frame", "[ui]" )
+{
+    ui_manager::frame_pacer pacer;
+    const ui_manager::frame_pacer::time_point start = std::chrono::steady_clock::now();
+    pacer.record_frame( start, start + 5ms );
+
+    // 30 fps is one frame every 33333 us, counted from the end of the last frame.
+    CHECK_FALSE( pacer.frame_due( start + 5ms, 30 ) );
+    CHECK_FALSE( pacer.frame_due( start + 5ms + 33332us, 30 ) );
+    CHECK( pacer.frame_due( start + 5ms + 33333us, 30 ) );
+    CHECK( pacer.frame_due( start + 5ms + 1s, 30 ) );
+    CHECK( pacer.stats().frames_skipped == 2 );
+
+    // Pacing turned off.
+    CHECK( pacer.frame_due( start + 5ms, 0 ) );
+    CHECK( pacer.stats().frames_skipped == 2 );
+
+    // The next interval starts when the next frame ends.
+    pacer.record_frame( start + 100ms, start + 110ms );
+    CHECK_FALSE( pacer.frame_due( start + 120ms, 30 ) );
+    CHECK( pacer.frame_due( start + 145ms, 30 ) );
+    CHECK( pacer.stats().frames_skipped == 3 );
+}
+
+TEST_CASE( "frame_stats_track_frame_times", "[ui]" )
+{
+    ui_manager::frame_pacer pacer;
+    const ui_manager::frame_pacer::time_point start = std::chrono::steady_clock::now();
+
+    pacer.record_frame( start, start + 10ms );
+    CHECK( pacer.stats().frames_drawn == 1 );
+    CHECK( pacer.stats().last_frame == 10ms );
+    CHECK( pacer.stats().average_frame == 10ms );
+    CHECK( pacer.stats().worst_frame == 10ms );
+
+    pacer.record_frame( start + 20ms, start + 46ms );
+    CHECK( pacer.stats().frames_drawn == 2 );
+    CHECK( pacer.stats().last_frame == 26ms );
+    // Moves a sixteenth of the way towards the new frame time.
+    CHECK( pacer.stats().average_frame == 11ms );
+    CHECK( pacer.stats().worst_frame == 26ms );
+
+    pacer.record_frame( start + 50ms, start + 52ms );
+    CHECK( pacer.stats().last_frame == 2ms );
+    CHECK( pacer.stats().average_frame == 10438us );
+    CHECK( pacer.stats().worst_frame == 26ms );
+
+    pacer.reset_stats();
+    CHECK( pacer.stats().frames_drawn == 0 );
+    CHECK( pacer.stats().worst_frame == 0us );
+    // Resetting the stats does not forget when the last frame ended.
+    CHECK_FALSE( pacer.frame_due( start + 60ms, 30 ) );
+}
+
+TEST_CASE( "fast_forward_frame_due_follows_the_option", "[ui]" )
+{
+    override_option opt( "FAST_FORWARD_FPS", "0" );
+    ui_manager::reset_frame_stats();
+    CHECK( ui_manager::fast_forward_frame_due() );
+    CHECK( ui_manager::get_frame_stats().frames_skipped == 0 );
+}
@@ -0,0 +1,104 @@
+#include <string>
+#include <utility>
+
+#include "avatar.h"
+#include "cata_catch.h"
+#include "dialogue.h"
+#include "dialogue_helpers.h"
+#include "global_vars.h"
+#include "math_parser_diag_value.h"
+#include "npc.h"
+#include "talker.h"
+
+static double slot_value( const diag_var_map &vars, const std::string &name )
+{
+    diag_value const *ret = vars.find_slot( var_slots::intern( name ) );
+    return ret ? ret->dbl() : -1;
+}
+
+TEST_CASE( "diag_var_map_slot_index", "[eoc][math_parser]" )
+{
+    diag_var_map vars;
+    vars["var_slots_test_a"] = diag_value( 1.0 );
+    vars.insert( { "var_slots_test_b", diag_value( 2.0 ) } );
+    vars.emplace( "var_slots_test_c", diag_value( 3.0 ) );
+
+    // Interned after the keys went in.
+    CHECK( slot_value( vars, "var_slots_test_a" ) == 1 );
+    CHECK( slot_value( vars, "var_slots_test_b" ) == 2 );
+    CHECK( slot_value( vars, "var_slots_test_c" ) == 3 );
+    CHECK( slot_value( vars, "var_slots_test_missing" ) == -1 );
+
+    vars["var_slots_test_d"] = diag_value( 4.0 );
+    CHECK( slot_value( vars, "var_slots_test_d" ) == 4 );
+
+    SECTION( "erase" ) {
+        vars.erase( "var_slots_test_b" );
+        vars.erase( vars.find( "var_slots_test_c" ) );
+        CHECK( slot_value( vars, "var_slots_test_b" ) == -1 );
+        CHECK( slot_value( vars, "var_slots_test_c" ) == -1 );
+        CHECK( slot_value( vars, "var_slots_test_a" ) == 1 );
+    }
+
+    SECTION( "change a value in place" ) {
+        vars.find( "var_slots_test_b" )->second = diag_value( 20.0 );
+        for( diag_var_map::value_type &v : vars ) {
+            if( v.first == "var_slots_test_c" ) {
+                v.second = diag_value( 30.0 );
+            }
+        }
+        CHECK( slot_value( vars, "var_slots_test_b" ) == 20 );
+        CHECK( slot_value( vars, "var_slots_test_c" ) == 30 );
+    }
+
+    SECTION( "rename through a node" ) {
+        diag_var_map::node_type node = vars.extract( "var_slots_test_a" );
+        node.key() = "var_slots_test_e";
+        vars.insert( std::move( node ) );
+        CHECK( slot_value( vars, "var_slots_test_a" ) == -1 );
+        CHECK( slot_value( vars, "var_slots_test_e" ) == 1 );
+    }
+
+    SECTION( "copy, move and clear" ) {
+        diag_var_map copy = vars;
+        copy["var_slots_test_a"] = diag_value( 10.0 );
+        CHECK( slot_value( copy, "var_slots_test_a" ) == 10 );
+        CHECK( slot_value( vars, "var_slots_test_a" ) == 1 );
+
+        diag_var_map moved = std::move( copy );
+        CHECK( slot_value( moved, "var_slots_test_a" ) == 10 );
+
+        vars.clear();
+        CHECK( slot_value( vars, "var_slots_test_a" ) == -1 );
+    }
+}
+
+TEST_CASE( "interned_var_info_reads", "[eoc][math_parser]" )
+{
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    get_globals().set_global_value( "var_slots_test_global", 5 );
+    get_avatar().set_value( "var_slots_test_u", 6 );
+    dude.set_value( "var_slots_test_n", 7 );
+    d.set_value( "var_slots_test_context", 8 );
+
+    var_info global( var_type::global, "var_slots_test_global" );
+    var_info u( var_type::u, "var_slots_test_u" );
+    var_info n( var_type::npc, "var_slots_test_n" );
+    var_info context( var_type::context, "var_slots_test_context" );
+    for( var_info *info : { &global, &u, &n, &context } ) {
+        CAPTURE( info->name );
+        const double by_name = read_var_value( *info, d ).dbl();
+        info->intern();
+        CHECK( read_var_value( *info, d ).dbl() == by_name );
+    }
+    CHECK( read_var_value( global, d ).dbl() == 5 );
+    CHECK( read_var_value( u, d ).dbl() == 6 );
+    CHECK( read_var_value( n, d ).dbl() == 7 );
+    CHECK( read_var_value( context, d ).dbl() == 8 );
+
+    get_globals().remove_global_value( "var_slots_test_global" );
+    get_avatar().remove_value( "var_slots_test_u" );
+    CHECK( maybe_read_var_value( global, d ) == nullptr );
+    CHECK( maybe_read_var_value( u, d ) == nullptr );
+}